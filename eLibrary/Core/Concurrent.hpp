@@ -5,6 +5,7 @@
 
 #include <Core/Container.hpp>
 #include <Core/Number.hpp>
+#include <bit>
 
 #if eLibraryCompiler(MSVC)
 #include <intrin.h>
@@ -190,7 +191,8 @@ namespace eLibrary::Core {
         }
 
         static T doLoad(volatile T &ValueAddress, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
-            return __atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder));
+            auto ValueResult(__atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder)));
+            return ::std::bit_cast<T>(ValueResult);
         }
 
         static T doOrFetch(volatile T &ValueAddress, T ValueTarget, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
@@ -335,7 +337,8 @@ namespace eLibrary::Core {
         }
 
         static T doLoad(volatile T &ValueAddress, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
-            return __atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder));
+            auto ValueResult(__atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder)));
+            return ::std::bit_cast<T>(ValueResult);
         }
 
         static T doOrFetch(volatile T &ValueAddress, T ValueTarget, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
@@ -480,7 +483,8 @@ namespace eLibrary::Core {
         }
 
         static T doLoad(volatile T &ValueAddress, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
-            return __atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder));
+            auto ValueResult(__atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder)));
+            return ::std::bit_cast<T>(ValueResult);
         }
 
         static T doOrFetch(volatile T &ValueAddress, T ValueTarget, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
@@ -625,7 +629,8 @@ namespace eLibrary::Core {
         }
 
         static T doLoad(volatile T &ValueAddress, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
-            return __atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder));
+            auto ValueResult(__atomic_load_n(ConcurrentOperation<T, 0>::template doCastAddress<ParameterType>(ValueAddress), int(ValueOrder)));
+            return ::std::bit_cast<T>(ValueResult);
         }
 
         static T doOrFetch(volatile T &ValueAddress, T ValueTarget, MemoryOrder ValueOrder = MemoryOrder::OrderSeqCst) noexcept {
@@ -797,8 +802,9 @@ namespace eLibrary::Core {
     class Mutex final : public AtomicStorage<bool> {
     public:
         void doLock() noexcept {
-            while (this->getValue()) doYieldCpu();
-            this->setValue(true);
+            // Acquire by compare-exchange and spin on plain loads, so two waiters can never both see the flag clear and take it
+            while (!tryLock())
+                while (this->getValue()) doYieldCpu();
         }
 
         void doUnlock() noexcept {
@@ -1035,6 +1041,338 @@ namespace eLibrary::Core {
         }
     };
 
+    /**
+     * Support for concurrent key-value mappings with lock-free lookups, striped updates and incremental resizing
+     */
+    template<typename K, typename V>
+    class ConcurrentHashMap final : public Object, public NonCopyable, public NonMovable {
+    private:
+        static constexpr uintmax_t ReaderStripeCount = 64, RetireThreshold = 64, StripeCount = 64, TransferSize = 16;
+        static constexpr uintptr_t NodeForward = 1;
+
+        struct ConcurrentNode final {
+            K NodeKey;
+            V NodeValue;
+            uintmax_t NodeHash;
+            AtomicStorage<ConcurrentNode*> NodeNext{nullptr};
+            ConcurrentNode *NodeRetire = nullptr;
+
+            ConcurrentNode(const K &NodeKeySource, const V &NodeValueSource, uintmax_t NodeHashSource) noexcept : NodeKey(NodeKeySource), NodeValue(NodeValueSource), NodeHash(NodeHashSource) {}
+        };
+
+        struct ConcurrentTable final {
+            uintmax_t TableCapacity;
+            AtomicStorage<ConcurrentNode*> *TableBucket = nullptr;
+            AtomicStorage<ConcurrentTable*> TableNext{nullptr};
+            AtomicStorage<uintmax_t> TableTransfer{0}, TableTransferred{0};
+            ConcurrentTable *TableRetire = nullptr;
+
+            explicit ConcurrentTable(uintmax_t TableCapacitySource) noexcept : TableCapacity(TableCapacitySource) {}
+        };
+
+        struct alignas(64) ConcurrentReader final {
+            AtomicStorage<uintmax_t> ReaderCount[2]{0, 0};
+        };
+
+        /**
+         * Nodes unlinked under the stripe lock are retired to the stripe itself, one list per epoch parity
+         */
+        struct alignas(64) ConcurrentStripe final {
+            Mutex StripeMutex;
+            AtomicStorage<intmax_t> StripeSize{0};
+            ConcurrentNode *StripeRetire[2]{nullptr, nullptr};
+            uintmax_t StripeRetireEpoch[2]{0, 0};
+            uintmax_t StripeRetireCount = 0;
+        };
+
+        /**
+         * Keeps the calling thread counted in the current epoch, so nothing it can reach is released
+         */
+        class ConcurrentReaderLocker final : public NonCopyable, public NonMovable {
+        private:
+            AtomicStorage<uintmax_t> &ReaderCounter;
+        public:
+            explicit ConcurrentReaderLocker(const ConcurrentHashMap *MapSource) noexcept : ReaderCounter(MapSource->doEnter()) {}
+
+            ~ConcurrentReaderLocker() noexcept {
+                ReaderCounter.doFetchSub(1);
+            }
+        };
+
+        mutable ConcurrentReader MapReader[ReaderStripeCount];
+        ConcurrentStripe MapStripe[StripeCount];
+        AtomicStorage<ConcurrentTable*> TableCurrent{nullptr};
+        mutable MemoryAllocator<ConcurrentNode> NodeAllocator{SynchronizedPoolMemoryResource::getInstance()};
+        AtomicStorage<uintmax_t> RetireEpoch{1};
+        Mutex RetireMutex;
+        ConcurrentTable *TableRetire[2]{nullptr, nullptr};
+        uintmax_t TableRetireEpoch[2]{0, 0};
+
+        void doAdvance() noexcept {
+            uintmax_t ReaderEpoch = RetireEpoch.getValue();
+            for (uintmax_t ReaderIndex = 0;ReaderIndex < ReaderStripeCount;++ReaderIndex)
+                if (MapReader[ReaderIndex].ReaderCount[(ReaderEpoch - 1) & 1].getValue()) return;
+            if (!RetireEpoch.doCompareExchangeValue(ReaderEpoch, ReaderEpoch + 1) || !RetireMutex.tryLock()) return;
+            doReclaim(ReaderEpoch + 1);
+            RetireMutex.doUnlock();
+        }
+
+        ConcurrentTable *doCreateTable(uintmax_t TableCapacity) noexcept {
+            auto *TableTarget = MemoryAllocator<ConcurrentTable>(NodeAllocator).acquireObject(TableCapacity);
+            MemoryAllocator<AtomicStorage<ConcurrentNode*>> BucketAllocator(NodeAllocator);
+            TableTarget->TableBucket = BucketAllocator.doAllocate(TableCapacity);
+            for (uintmax_t BucketIndex = 0;BucketIndex < TableCapacity;++BucketIndex)
+                BucketAllocator.doConstruct(TableTarget->TableBucket + BucketIndex, nullptr);
+            return TableTarget;
+        }
+
+        void doDestroyTable(ConcurrentTable *TableTarget) noexcept {
+            MemoryAllocator<AtomicStorage<ConcurrentNode*>>(NodeAllocator).doDeallocate(TableTarget->TableBucket, TableTarget->TableCapacity);
+            MemoryAllocator<ConcurrentTable>(NodeAllocator).releaseObject(TableTarget);
+        }
+
+        AtomicStorage<uintmax_t> &doEnter() const noexcept {
+            static AtomicStorage<uintmax_t> ReaderIndexNext{0};
+            static thread_local uintmax_t ReaderIndex = ReaderIndexNext.doFetchAdd(1);
+            ConcurrentReader &ReaderCurrent = MapReader[ReaderIndex % ReaderStripeCount];
+            for (;;) {
+                uintmax_t ReaderEpoch = RetireEpoch.getValue();
+                ReaderCurrent.ReaderCount[ReaderEpoch & 1].doFetchAdd(1);
+                if (RetireEpoch.getValue() == ReaderEpoch) return ReaderCurrent.ReaderCount[ReaderEpoch & 1];
+                ReaderCurrent.ReaderCount[ReaderEpoch & 1].doFetchSub(1);
+            }
+        }
+
+        template<typename F>
+        auto doModify(const K &NodeKey, F Operation) {
+            ConcurrentReaderLocker ReaderLocker(this);
+            uintmax_t NodeHash = HashTable<K, V>::getHash(NodeKey);
+            ConcurrentTable *TableTarget = TableCurrent.getValue();
+            if (ConcurrentTable *TableNext = TableTarget->TableNext.getValue()) doTransfer(TableTarget, TableNext);
+            for (;;) {
+                uintmax_t BucketIndex = NodeHash & (TableTarget->TableCapacity - 1);
+                ConcurrentStripe &StripeTarget = MapStripe[BucketIndex % StripeCount];
+                MutexLocker StripeLocker(StripeTarget.StripeMutex);
+                AtomicStorage<ConcurrentNode*> &BucketTarget = TableTarget->TableBucket[BucketIndex];
+                ConcurrentNode *NodePrevious = nullptr, *NodeCurrent = BucketTarget.getValue();
+                if ((uintptr_t) NodeCurrent == NodeForward) {
+                    TableTarget = TableTarget->TableNext.getValue();
+                    continue;
+                }
+                while (NodeCurrent && (NodeCurrent->NodeHash != NodeHash || Objects::doCompare(NodeCurrent->NodeKey, NodeKey))) {
+                    NodePrevious = NodeCurrent;
+                    NodeCurrent = NodeCurrent->NodeNext.getValue();
+                }
+                return Operation(TableTarget, StripeTarget, NodePrevious ? NodePrevious->NodeNext : BucketTarget, NodeCurrent, NodeHash);
+            }
+        }
+
+        void doInsert(ConcurrentTable *TableTarget, ConcurrentStripe &StripeTarget, AtomicStorage<ConcurrentNode*> &NodeLink, ConcurrentNode *NodeCurrent, const K &NodeKey, const V &NodeValue, uintmax_t NodeHash) noexcept {
+            auto *NodeTarget = NodeAllocator.acquireObject(NodeKey, NodeValue, NodeHash);
+            if (NodeCurrent) {
+                NodeTarget->NodeNext.setValue(NodeCurrent->NodeNext.getValue());
+                NodeLink.setValue(NodeTarget);
+                doRetire(StripeTarget, NodeCurrent);
+                return;
+            }
+            NodeTarget->NodeNext.setValue(NodeLink.getValue());
+            NodeLink.setValue(NodeTarget);
+            if ((uintmax_t) StripeTarget.StripeSize.doAddFetch(1) * StripeCount * 4 > TableTarget->TableCapacity * 3 && TableTarget == TableCurrent.getValue() && !TableTarget->TableNext.getValue()) {
+                ConcurrentTable *TableNext = doCreateTable(TableTarget->TableCapacity << 1), *TableExpected = nullptr;
+                if (!TableTarget->TableNext.doCompareExchangeValue(TableExpected, TableNext)) doDestroyTable(TableNext);
+            }
+        }
+
+        /**
+         * Releases the tables retired two or more epochs before the epoch, which no reader can reach any more
+         */
+        void doReclaim(uintmax_t ReaderEpoch) noexcept {
+            if (TableRetireEpoch[ReaderEpoch & 1] == ReaderEpoch) return;
+            while (ConcurrentTable *TableTarget = TableRetire[ReaderEpoch & 1]) {
+                TableRetire[ReaderEpoch & 1] = TableTarget->TableRetire;
+                doDestroyTable(TableTarget);
+            }
+            TableRetireEpoch[ReaderEpoch & 1] = ReaderEpoch;
+        }
+
+        /**
+         * Must be called under the stripe lock; the epoch is only advanced once per RetireThreshold retirements of the stripe
+         */
+        void doRetire(ConcurrentStripe &StripeTarget, ConcurrentNode *NodeTarget) noexcept {
+            uintmax_t ReaderEpoch = RetireEpoch.getValue();
+            // The list of the same parity holds nodes from two or more epochs ago, whose readers have all left
+            if (StripeTarget.StripeRetireEpoch[ReaderEpoch & 1] != ReaderEpoch) {
+                while (ConcurrentNode *NodeCurrent = StripeTarget.StripeRetire[ReaderEpoch & 1]) {
+                    StripeTarget.StripeRetire[ReaderEpoch & 1] = NodeCurrent->NodeRetire;
+                    NodeAllocator.releaseObject(NodeCurrent);
+                }
+                StripeTarget.StripeRetireEpoch[ReaderEpoch & 1] = ReaderEpoch;
+            }
+            NodeTarget->NodeRetire = StripeTarget.StripeRetire[ReaderEpoch & 1];
+            StripeTarget.StripeRetire[ReaderEpoch & 1] = NodeTarget;
+            if (++StripeTarget.StripeRetireCount % RetireThreshold == 0) doAdvance();
+        }
+
+        void doRetire(ConcurrentTable *TableTarget) noexcept {
+            {
+                MutexLocker RetireLocker(RetireMutex);
+                uintmax_t ReaderEpoch = RetireEpoch.getValue();
+                doReclaim(ReaderEpoch);
+                TableTarget->TableRetire = TableRetire[ReaderEpoch & 1];
+                TableRetire[ReaderEpoch & 1] = TableTarget;
+            }
+            doAdvance();
+        }
+
+        void doTransfer(ConcurrentTable *TableSource, ConcurrentTable *TableTarget) noexcept {
+            uintmax_t BucketStart = TableSource->TableTransfer.doFetchAdd(TransferSize);
+            if (BucketStart >= TableSource->TableCapacity) return;
+            for (uintmax_t BucketIndex = BucketStart;BucketIndex < BucketStart + TransferSize;++BucketIndex) {
+                ConcurrentStripe &StripeSource = MapStripe[BucketIndex % StripeCount];
+                MutexLocker StripeLocker(StripeSource.StripeMutex);
+                ConcurrentNode *NodeCurrent = TableSource->TableBucket[BucketIndex].getValue();
+                while (NodeCurrent) {
+                    AtomicStorage<ConcurrentNode*> &BucketTarget = TableTarget->TableBucket[NodeCurrent->NodeHash & (TableTarget->TableCapacity - 1)];
+                    auto *NodeTarget = NodeAllocator.acquireObject(NodeCurrent->NodeKey, NodeCurrent->NodeValue, NodeCurrent->NodeHash);
+                    NodeTarget->NodeNext.setValue(BucketTarget.getValue());
+                    BucketTarget.setValue(NodeTarget);
+                    NodeCurrent = NodeCurrent->NodeNext.getValue();
+                }
+                NodeCurrent = TableSource->TableBucket[BucketIndex].getValue();
+                TableSource->TableBucket[BucketIndex].setValue((ConcurrentNode*) NodeForward);
+                while (NodeCurrent) {
+                    ConcurrentNode *NodeNext = NodeCurrent->NodeNext.getValue();
+                    doRetire(StripeSource, NodeCurrent);
+                    NodeCurrent = NodeNext;
+                }
+            }
+            if (TableSource->TableTransferred.doAddFetch(TransferSize) == TableSource->TableCapacity) {
+                TableCurrent.setValue(TableTarget);
+                doRetire(TableSource);
+            }
+        }
+
+        ConcurrentNode *doSearchCore(const K &NodeKey) const noexcept {
+            uintmax_t NodeHash = HashTable<K, V>::getHash(NodeKey);
+            ConcurrentTable *TableTarget = TableCurrent.getValue();
+            for (;;) {
+                ConcurrentNode *NodeCurrent = TableTarget->TableBucket[NodeHash & (TableTarget->TableCapacity - 1)].getValue();
+                if ((uintptr_t) NodeCurrent == NodeForward) {
+                    TableTarget = TableTarget->TableNext.getValue();
+                    continue;
+                }
+                while (NodeCurrent && (NodeCurrent->NodeHash != NodeHash || Objects::doCompare(NodeCurrent->NodeKey, NodeKey)))
+                    NodeCurrent = NodeCurrent->NodeNext.getValue();
+                return NodeCurrent;
+            }
+        }
+    public:
+        ConcurrentHashMap() noexcept {
+            TableCurrent.setValue(doCreateTable(StripeCount));
+        }
+
+        explicit ConcurrentHashMap(MemoryResource *ResourceSource) noexcept : NodeAllocator(ResourceSource) {
+            TableCurrent.setValue(doCreateTable(StripeCount));
+        }
+
+        ~ConcurrentHashMap() noexcept {
+            for (ConcurrentTable *TableTarget = TableCurrent.getValue();TableTarget;) {
+                for (uintmax_t BucketIndex = 0;BucketIndex < TableTarget->TableCapacity;++BucketIndex) {
+                    ConcurrentNode *NodeCurrent = TableTarget->TableBucket[BucketIndex].getValue();
+                    if ((uintptr_t) NodeCurrent == NodeForward) continue;
+                    while (NodeCurrent) {
+                        ConcurrentNode *NodeNext = NodeCurrent->NodeNext.getValue();
+                        NodeAllocator.releaseObject(NodeCurrent);
+                        NodeCurrent = NodeNext;
+                    }
+                }
+                ConcurrentTable *TableNext = TableTarget->TableNext.getValue();
+                doDestroyTable(TableTarget);
+                TableTarget = TableNext;
+            }
+            for (uintmax_t RetireIndex = 0;RetireIndex < 2;++RetireIndex) {
+                for (ConcurrentStripe &StripeCurrent : MapStripe)
+                    while (ConcurrentNode *NodeTarget = StripeCurrent.StripeRetire[RetireIndex]) {
+                        StripeCurrent.StripeRetire[RetireIndex] = NodeTarget->NodeRetire;
+                        NodeAllocator.releaseObject(NodeTarget);
+                    }
+                while (ConcurrentTable *TableTarget = TableRetire[RetireIndex]) {
+                    TableRetire[RetireIndex] = TableTarget->TableRetire;
+                    doDestroyTable(TableTarget);
+                }
+            }
+        }
+
+        /**
+         * Returns the value mapped to the key, first mapping the result of the operation if there is none;
+         * the operation runs at most once per call, under the lock of the key's stripe
+         */
+        template<typename F>
+        V doComputeIfAbsent(const K &MapKey, F Operation) {
+            return doModify(MapKey, [&](ConcurrentTable *TableTarget, ConcurrentStripe &StripeTarget, AtomicStorage<ConcurrentNode*> &NodeLink, ConcurrentNode *NodeCurrent, uintmax_t NodeHash) -> V {
+                if (NodeCurrent) return NodeCurrent->NodeValue;
+                V MapValue(Operation(MapKey));
+                doInsert(TableTarget, StripeTarget, NodeLink, nullptr, MapKey, MapValue, NodeHash);
+                return MapValue;
+            });
+        }
+
+        Optional<V> doSearch(const K &MapKey) const noexcept {
+            ConcurrentReaderLocker ReaderLocker(this);
+            ConcurrentNode *NodeResult = doSearchCore(MapKey);
+            if (NodeResult == nullptr) return {};
+            return {NodeResult->NodeValue};
+        }
+
+        const char *getClassName() const noexcept {
+            return "ConcurrentHashMap";
+        }
+
+        V getElement(const K &MapKey) const {
+            ConcurrentReaderLocker ReaderLocker(this);
+            ConcurrentNode *NodeResult = doSearchCore(MapKey);
+            if (!NodeResult) [[unlikely]]
+                doThrowChecked(IndexException, u"ConcurrentHashMap<K, V>::getElement(const K&) doSearchCore"_S);
+            return NodeResult->NodeValue;
+        }
+
+        uintmax_t getElementSize() const noexcept {
+            intmax_t ElementSize = 0;
+            for (uintmax_t StripeIndex = 0;StripeIndex < StripeCount;++StripeIndex)
+                ElementSize += MapStripe[StripeIndex].StripeSize.getValue();
+            return (uintmax_t) Objects::getMaximum(ElementSize, 0);
+        }
+
+        MemoryResource *getMemoryResource() const noexcept {
+            return NodeAllocator.getMemoryResource();
+        }
+
+        bool isContainsKey(const K &MapKey) const noexcept {
+            ConcurrentReaderLocker ReaderLocker(this);
+            return doSearchCore(MapKey);
+        }
+
+        bool isEmpty() const noexcept {
+            return !getElementSize();
+        }
+
+        void removeMapping(const K &MapKey) {
+            doModify(MapKey, [&](ConcurrentTable*, ConcurrentStripe &StripeTarget, AtomicStorage<ConcurrentNode*> &NodeLink, ConcurrentNode *NodeCurrent, uintmax_t) {
+                if (!NodeCurrent) [[unlikely]]
+                    doThrowChecked(IndexException, u"ConcurrentHashMap<K, V>::removeMapping(const K&) MapKey"_S);
+                NodeLink.setValue(NodeCurrent->NodeNext.getValue());
+                StripeTarget.StripeSize.doFetchSub(1);
+                doRetire(StripeTarget, NodeCurrent);
+            });
+        }
+
+        void setMapping(const K &MapKey, const V &MapValue) {
+            doModify(MapKey, [&](ConcurrentTable *TableTarget, ConcurrentStripe &StripeTarget, AtomicStorage<ConcurrentNode*> &NodeLink, ConcurrentNode *NodeCurrent, uintmax_t NodeHash) {
+                doInsert(TableTarget, StripeTarget, NodeLink, NodeCurrent, MapKey, MapValue, NodeHash);
+            });
+        }
+    };
+
     template<typename E, typename C>
     class ConcurrentQueue final : public Object {
     private:
@@ -1058,6 +1396,11 @@ namespace eLibrary::Core {
             MutexLocker QueueLock(QueueMutex);
             QueueObject.addBack(QueueSource);
         }
+
+        void doEnqueue(E &&QueueSource) {
+            MutexLocker QueueLock(QueueMutex);
+            QueueObject.addBack(Objects::doMove(QueueSource));
+        }
     };
 
     class ThreadExecutor final : public Object, public NonCopyable, public NonMovable {
@@ -1069,22 +1412,26 @@ namespace eLibrary::Core {
             ThreadExecutorCore(ThreadExecutor *ExecutorSource) : ExecutorObject(ExecutorSource) {}
 
             void doExecute() noexcept override {
-                Function<void()> ExecutorFunction;
+                MoveOnlyFunction<void()> ExecutorFunction;
                 bool ExecutorFunctionAvailable;
-                while (!ExecutorObject->ExecutorShutdown) {
+                for (;;) {
                     {
                         ::std::unique_lock<::std::mutex> ExecutorLock(ExecutorObject->ExecutorMutex);
-                        if (ExecutorObject->ExecutorQueue.isEmpty()) ExecutorObject->ExecutorVariable.wait(ExecutorLock);
+                        ExecutorObject->ExecutorVariable.wait(ExecutorLock, [this] {
+                            return ExecutorObject->ExecutorShutdown.getValue() || !ExecutorObject->ExecutorQueue.isEmpty();
+                        });
+                        // Tasks queued before doShutdown still run, so none of their futures is left with a broken promise
                         ExecutorFunctionAvailable = ExecutorObject->ExecutorQueue.doDequeue(ExecutorFunction);
                     }
-                    if (ExecutorFunctionAvailable) ExecutorFunction();
+                    if (!ExecutorFunctionAvailable) break;
+                    ExecutorFunction();
                 }
             }
         };
 
         ::std::mutex ExecutorMutex;
-        ConcurrentQueue<Function<void()>, DoubleLinkedList<Function<void()>>> ExecutorQueue;
-        bool ExecutorShutdown = false;
+        ConcurrentQueue<MoveOnlyFunction<void()>, DoubleLinkedList<MoveOnlyFunction<void()>>> ExecutorQueue;
+        AtomicStorage<bool> ExecutorShutdown{false};
         Array<ThreadExecutorCore*> ExecutorThread;
         ::std::condition_variable ExecutorVariable;
     public:
@@ -1100,7 +1447,11 @@ namespace eLibrary::Core {
         }
 
         void doShutdown() noexcept {
-            ExecutorShutdown = true;
+            {
+                ::std::lock_guard<::std::mutex> ExecutorLock(ExecutorMutex);
+                if (ExecutorShutdown.getValue()) return;
+                ExecutorShutdown.setValue(true);
+            }
             ExecutorVariable.notify_all();
             Collections::doTraverse(ExecutorThread.begin(), ExecutorThread.end(), [](ThreadExecutorCore *ExecutorCore){
                 ExecutorCore->doJoin();
@@ -1113,19 +1464,20 @@ namespace eLibrary::Core {
          */
         template<typename F, typename ...Ps>
         auto doSubmit(F &&ExecutorFunction, Ps &&...ExecutorFunctionParameter) -> ::std::future<decltype(ExecutorFunction(ExecutorFunctionParameter...))> {
-            if (ExecutorShutdown) doThrowChecked(ConcurrentException, u"ThreadExecutor::doSubmit<F, Ps...>(F&&, Ps&&...) ExecutorShutdown"_S);
-            auto ExecutorTarget(::std::bind(Objects::doForward<F>(ExecutorFunction), Objects::doForward<Ps>(ExecutorFunctionParameter)...));
-            auto ExecutorTask(::std::make_shared<::std::packaged_task<decltype(ExecutorTarget(ExecutorFunctionParameter...))()>>(ExecutorTarget));
-            Function<void()> ExecutorWrapper = [ExecutorTask] {
-                (*ExecutorTask)();
-            };
-            ExecutorQueue.doEnqueue(ExecutorWrapper);
+            ::std::packaged_task<decltype(ExecutorFunction(ExecutorFunctionParameter...))()> ExecutorTask(::std::bind(Objects::doForward<F>(ExecutorFunction), Objects::doForward<Ps>(ExecutorFunctionParameter)...));
+            auto ExecutorFuture(ExecutorTask.get_future());
+            {
+                ::std::lock_guard<::std::mutex> ExecutorLock(ExecutorMutex);
+                // Checked under the lock so that no task is enqueued after doShutdown has released its workers
+                if (ExecutorShutdown.getValue()) doThrowChecked(ConcurrentException, u"ThreadExecutor::doSubmit<F, Ps...>(F&&, Ps&&...) ExecutorShutdown"_S);
+                ExecutorQueue.doEnqueue(MoveOnlyFunction<void()>(Objects::doMove(ExecutorTask)));
+            }
             ExecutorVariable.notify_one();
-            return ExecutorTask->get_future();
+            return ExecutorFuture;
         }
 
         bool isShutdown() const noexcept {
-            return ExecutorShutdown;
+            return ExecutorShutdown.getValue();
         }
     };
 
@@ -5,10 +5,16 @@
 
 #include <Core/Exception.hpp>
 #include <Core/Memory.hpp>
+#include <bit>
+#include <cstring>
 #include <iterator>
 #include <typeinfo>
 #include <utility>
 
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+#include <emmintrin.h>
+#endif
+
 namespace eLibrary::Core {
     namespace {
         template<typename E>
@@ -17,6 +23,8 @@ namespace eLibrary::Core {
             DoubleLinkedNode *NodeNext = nullptr, *NodePrevious = nullptr;
 
             explicit DoubleLinkedNode(const E &NodeValueSource) : NodeValue(NodeValueSource) {}
+
+            explicit DoubleLinkedNode(E &&NodeValueSource) : NodeValue(Objects::doMove(NodeValueSource)) {}
         };
 
         template<typename E>
@@ -25,50 +33,76 @@ namespace eLibrary::Core {
             SingleLinkedNode *NodeNext = nullptr;
 
             explicit SingleLinkedNode(const E &NodeValueSource) : NodeValue(NodeValueSource) {}
+
+            explicit SingleLinkedNode(E &&NodeValueSource) : NodeValue(Objects::doMove(NodeValueSource)) {}
         };
     }
 
+    /**
+     * Support for type-erased storage of single objects
+     */
     class Any final : public Object {
     private:
         enum class AnyOperation {
             OperationCopy, OperationDestroy, OperationMove
         };
 
-        void *AnyValue = nullptr;
+        static constexpr size_t AnyStorageSize = 4 * sizeof(void*);
+
+        union {
+            alignas(::std::max_align_t) uint8_t AnyStorage[AnyStorageSize];
+            void *AnyHandle;
+        };
         const ::std::type_info *AnyType = &typeid(void);
+        void (*AnyFunction)(AnyOperation, Any*, Any*) = nullptr;
 
-        void (*AnyFunction)(AnyOperation, Any *, void*) = nullptr;
+        template<typename T>
+        static constexpr bool isInline = sizeof(T) <= AnyStorageSize && alignof(T) <= alignof(::std::max_align_t) && ::std::is_nothrow_move_constructible_v<T>;
+
+        template<typename T>
+        static constexpr bool isTrivial = isInline<T> && Type::isTriviallyCopyable<T>;
 
         template<typename T>
-        static void doExecute(AnyOperation ManagerOperation, Any *ManagerObject, void *ManagerSource) {
+        static void doExecute(AnyOperation ManagerOperation, Any *ManagerTarget, Any *ManagerSource) {
             switch (ManagerOperation) {
                 case AnyOperation::OperationCopy:
-                    ManagerObject->AnyValue = new T(*(const T *) ManagerSource);
+                    if constexpr (isInline<T>) ::new(ManagerTarget->AnyStorage) T(*ManagerSource->getObject<T>());
+                    else ManagerTarget->AnyHandle = new T(*ManagerSource->getObject<T>());
                     break;
                 case AnyOperation::OperationDestroy:
-                    MemoryAllocator<T>::doDestroy((T *) ManagerObject->AnyValue);
+                    if constexpr (isInline<T>) ManagerTarget->getObject<T>()->~T();
+                    else delete ManagerTarget->getObject<T>();
                     break;
                 case AnyOperation::OperationMove:
-                    ManagerObject->AnyValue = new T(Objects::doMove(*(T *) ManagerSource));
+                    if constexpr (isInline<T>) {
+                        ::new(ManagerTarget->AnyStorage) T(Objects::doMove(*ManagerSource->getObject<T>()));
+                        ManagerSource->getObject<T>()->~T();
+                    } else ManagerTarget->AnyHandle = ManagerSource->AnyHandle;
                     break;
             }
         }
 
+        template<typename T>
+        T *getObject() const noexcept {
+            if constexpr (isInline<T>) return ::std::launder(reinterpret_cast<T*>(const_cast<uint8_t*>(AnyStorage)));
+            else return static_cast<T*>(AnyHandle);
+        }
+
+        template<typename T>
+        bool isType() const noexcept {
+            return AnyType == &typeid(T) || *AnyType == typeid(T);
+        }
     public:
         doEnableCopyAssignConstruct(Any)
 
         doEnableMoveAssignConstruct(Any)
 
-        constexpr Any() = default;
+        Any() noexcept : AnyHandle(nullptr) {}
 
         template<typename T>
-        Any(const T &AnySource) {
-            doAssign(AnySource);
-        }
-
-        template<typename T>
-        Any(T &&AnySource) {
-            doAssign(Objects::doMove(AnySource));
+        requires (!Type::isSame<::std::decay_t<T>, Any>)
+        Any(T &&AnySource) : AnyHandle(nullptr) {
+            doAssign(Objects::doForward<T>(AnySource));
         }
 
         ~Any() {
@@ -76,64 +110,91 @@ namespace eLibrary::Core {
         }
 
         void doAssign(const Any &AnySource) {
+            if (Objects::getAddress(AnySource) == this) return;
             doReset();
-            if (AnySource.hasValue() && Objects::getAddress(AnySource) != this) {
-                AnyFunction = AnySource.AnyFunction;
-                AnyFunction(AnyOperation::OperationCopy, this, AnySource.AnyValue);
-                AnyType = AnySource.AnyType;
-            }
+            if (!AnySource.hasValue()) return;
+            if (AnySource.AnyFunction) AnySource.AnyFunction(AnyOperation::OperationCopy, this, const_cast<Any*>(Objects::getAddress(AnySource)));
+            else ::memcpy(AnyStorage, AnySource.AnyStorage, AnyStorageSize);
+            AnyFunction = AnySource.AnyFunction;
+            AnyType = AnySource.AnyType;
         }
 
         void doAssign(Any &&AnySource) noexcept {
+            if (Objects::getAddress(AnySource) == this) return;
             doReset();
-            if (AnySource.hasValue() && Objects::getAddress(AnySource) != this) {
-                AnyFunction = AnySource.AnyFunction;
-                AnyFunction(AnyOperation::OperationMove, this, AnySource.AnyValue);
-                AnyType = AnySource.AnyType;
-                AnySource.AnyFunction = nullptr;
-                AnySource.AnyType = &typeid(void);
-                AnySource.AnyValue = nullptr;
-            }
+            if (!AnySource.hasValue()) return;
+            if (AnySource.AnyFunction) AnySource.AnyFunction(AnyOperation::OperationMove, this, Objects::getAddress(AnySource));
+            else ::memcpy(AnyStorage, AnySource.AnyStorage, AnyStorageSize);
+            AnyFunction = AnySource.AnyFunction;
+            AnyType = AnySource.AnyType;
+            AnySource.AnyFunction = nullptr;
+            AnySource.AnyType = &typeid(void);
         }
 
         template<typename T>
-        void doAssign(const T &AnySource) {
+        requires (!Type::isSame<::std::decay_t<T>, Any>)
+        void doAssign(T &&AnySource) {
+            using Tv = ::std::decay_t<T>;
             doReset();
-            AnyFunction = &doExecute<T>;
-            AnyType = &typeid(T);
-            AnyValue = new T(AnySource);
+            if constexpr (isInline<Tv>) ::new(AnyStorage) Tv(Objects::doForward<T>(AnySource));
+            else AnyHandle = new Tv(Objects::doForward<T>(AnySource));
+            if constexpr (!isTrivial<Tv>) AnyFunction = &doExecute<Tv>;
+            AnyType = &typeid(Tv);
         }
 
+        /**
+         * Moves the contained value out and leaves this object empty
+         */
         template<typename T>
-        void doAssign(T &&AnySource) {
+        T doRelease() {
+            if (!hasValue()) [[unlikely]]
+                doThrowChecked(Exception, u"Any::doRelease<T>() hasValue"_S);
+            if (!isType<T>()) [[unlikely]]
+                doThrowChecked(TypeException, u"Any::doRelease<T>()"_S);
+            T AnyResult(Objects::doMove(*getObject<T>()));
             doReset();
-            AnyFunction = &doExecute<T>;
-            AnyType = &typeid(T);
-            AnyValue = new T(Objects::doMove(AnySource));
+            return AnyResult;
         }
 
-        void doReset() {
-            if (AnyFunction && AnyValue) AnyFunction(AnyOperation::OperationDestroy, this, nullptr);
+        void doReset() noexcept {
+            if (AnyFunction) AnyFunction(AnyOperation::OperationDestroy, this, nullptr);
             AnyFunction = nullptr;
             AnyType = &typeid(void);
-            AnyValue = nullptr;
         }
 
         template<typename T>
-        auto getValue() const {
-            if (&typeid(T) != AnyType) [[unlikely]]
-                doThrowChecked(TypeException, u"Any::getValue<T>()"_S);
+        T &getReference() {
+            if (!hasValue()) [[unlikely]]
+                doThrowChecked(Exception, u"Any::getReference<T>() hasValue"_S);
+            if (!isType<T>()) [[unlikely]]
+                doThrowChecked(TypeException, u"Any::getReference<T>()"_S);
+            return *getObject<T>();
+        }
+
+        template<typename T>
+        const T &getReference() const {
+            if (!hasValue()) [[unlikely]]
+                doThrowChecked(Exception, u"Any::getReference<T>() const hasValue"_S);
+            if (!isType<T>()) [[unlikely]]
+                doThrowChecked(TypeException, u"Any::getReference<T>() const"_S);
+            return *getObject<T>();
+        }
+
+        template<typename T>
+        T getValue() const {
             if (!hasValue()) [[unlikely]]
                 doThrowChecked(Exception, u"Any::getValue<T>() hasValue"_S);
-            return *((T *) AnyValue);
+            if (!isType<T>()) [[unlikely]]
+                doThrowChecked(TypeException, u"Any::getValue<T>()"_S);
+            return *getObject<T>();
         }
 
-        auto getValueType() noexcept {
+        auto getValueType() const noexcept {
             return AnyType;
         }
 
         bool hasValue() const noexcept {
-            return AnyValue;
+            return AnyType != &typeid(void);
         }
 
         template<typename T>
@@ -148,6 +209,28 @@ namespace eLibrary::Core {
     };
 
     class Collections final : public NonConstructable {
+    private:
+        template<typename I>
+        static constexpr bool isContiguous() noexcept {
+            if constexpr (Type::isPointer<I>) return true;
+            else if constexpr (requires {typename I::iterator_category;}) return Type::isSame<typename I::iterator_category, ::std::contiguous_iterator_tag>;
+            else return false;
+        }
+
+        template<typename II, typename OI>
+        static constexpr bool isMemoryCopyable() noexcept {
+            if constexpr (isContiguous<II>() && isContiguous<OI>()) {
+                using Ti = Type::noConst<Type::noReference<decltype(*::std::declval<II>())>>;
+                using To = Type::noReference<decltype(*::std::declval<OI>())>;
+                return Type::isSame<Ti, To> && Type::isTriviallyCopyable<To>;
+            } else return false;
+        }
+
+        template<typename II, typename OI>
+        static void doCopyMemory(II IteratorInput, uintmax_t IteratorInputSize, OI IteratorOutput) noexcept {
+            if (IteratorInputSize)
+                ::memmove(Objects::getAddress(*IteratorOutput), Objects::getAddress(*IteratorInput), IteratorInputSize * sizeof(*IteratorOutput));
+        }
     public:
         template<typename T1, typename T2>
         static void doCheckG(T1 IndexSource, T2 IndexStart) {
@@ -201,12 +284,21 @@ namespace eLibrary::Core {
 
         template<typename II, typename OI>
         static constexpr void doCopy(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>())
+                if (!::std::is_constant_evaluated()) {
+                    if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput);
+                    return;
+                }
             for (; IteratorInputStart != IteratorInputStop; ++IteratorInputStart, ++IteratorOutput)
                 *IteratorOutput = *IteratorInputStart;
         }
 
         template<typename II, typename OI>
         static void doCopy(II IteratorInput, uintmax_t IteratorInputSize, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                doCopyMemory(IteratorInput, IteratorInputSize, IteratorOutput);
+                return;
+            }
             while (IteratorInputSize) {
                 *IteratorOutput = *IteratorInput;
                 ++IteratorOutput;
@@ -217,12 +309,20 @@ namespace eLibrary::Core {
 
         template<typename II, typename OI>
         static void doCopyBackward(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput - (IteratorInputStop - IteratorInputStart));
+                return;
+            }
             while (IteratorInputStart != IteratorInputStop)
                 *(--IteratorOutput) = *(--IteratorInputStop);
         }
 
         template<typename II, typename OI>
         static void doCopyConstruct(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput);
+                return;
+            }
             using T = typename ::std::iterator_traits<OI>::value_type;
             for (; IteratorInputStart != IteratorInputStop; ++IteratorInputStart, ++IteratorOutput)
                 MemoryAllocator<T>::doConstruct(Objects::getAddress(*IteratorOutput), *IteratorInputStart);
@@ -230,6 +330,10 @@ namespace eLibrary::Core {
 
         template<typename II, typename OI>
         static void doCopyConstruct(II IteratorInput, uintmax_t IteratorInputSize, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                doCopyMemory(IteratorInput, IteratorInputSize, IteratorOutput);
+                return;
+            }
             using T = typename ::std::iterator_traits<OI>::value_type;
             while (IteratorInputSize) {
                 MemoryAllocator<T>::doConstruct(Objects::getAddress(*IteratorOutput), *IteratorInput);
@@ -250,18 +354,41 @@ namespace eLibrary::Core {
 
         template<typename II, typename T>
         static void doFill(II IteratorInputStart, II IteratorInputStop, const T &IteratorValue) {
+            if constexpr (isContiguous<II>()) {
+                using Te = Type::noReference<decltype(*::std::declval<II>())>;
+                if constexpr (Type::isTriviallyCopyable<Te> && sizeof(Te) == 1) {
+                    if (IteratorInputStart != IteratorInputStop) {
+                        Te IteratorTarget(IteratorValue);
+                        ::memset(Objects::getAddress(*IteratorInputStart), *(const unsigned char*) Objects::getAddress(IteratorTarget), IteratorInputStop - IteratorInputStart);
+                    }
+                    return;
+                } else if constexpr (Type::isIntegral<Te>) {
+                    if (IteratorInputStart != IteratorInputStop && Te(IteratorValue) == Te()) {
+                        ::memset(Objects::getAddress(*IteratorInputStart), 0, (IteratorInputStop - IteratorInputStart) * sizeof(Te));
+                        return;
+                    }
+                }
+            }
             for (; IteratorInputStart != IteratorInputStop; ++IteratorInputStart)
                 *IteratorInputStart = IteratorValue;
         }
 
         template<typename II, typename OI>
         static void doMove(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput);
+                return;
+            }
             for (; IteratorInputStart != IteratorInputStop; ++IteratorInputStart, ++IteratorOutput)
                 *IteratorOutput = Objects::doMove(*IteratorInputStart);
         }
 
         template<typename II, typename OI>
         static void doMove(II IteratorInput, uintmax_t IteratorInputSize, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                doCopyMemory(IteratorInput, IteratorInputSize, IteratorOutput);
+                return;
+            }
             while (IteratorInputSize) {
                 *IteratorOutput = Objects::doMove(*IteratorInput);
                 ++IteratorOutput;
@@ -272,12 +399,20 @@ namespace eLibrary::Core {
 
         template<typename II, typename OI>
         static void doMoveBackward(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput - (IteratorInputStop - IteratorInputStart));
+                return;
+            }
             while (IteratorInputStart != IteratorInputStop)
                 *(--IteratorOutput) = Objects::doMove(*(--IteratorInputStop));
         }
 
         template<typename II, typename OI>
         static void doMoveConstruct(II IteratorInputStart, II IteratorInputStop, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                if (IteratorInputStart != IteratorInputStop) doCopyMemory(IteratorInputStart, IteratorInputStop - IteratorInputStart, IteratorOutput);
+                return;
+            }
             using T = typename ::std::iterator_traits<OI>::value_type;
             for (; IteratorInputStart != IteratorInputStop; ++IteratorInputStart, ++IteratorOutput)
                 MemoryAllocator<T>::doConstruct(Objects::getAddress(*IteratorOutput), Objects::doMove(*IteratorInputStart));
@@ -285,6 +420,10 @@ namespace eLibrary::Core {
 
         template<typename II, typename OI>
         static void doMoveConstruct(II IteratorInput, uintmax_t IteratorInputSize, OI IteratorOutput) {
+            if constexpr (isMemoryCopyable<II, OI>()) {
+                doCopyMemory(IteratorInput, IteratorInputSize, IteratorOutput);
+                return;
+            }
             using T = typename ::std::iterator_traits<OI>::value_type;
             while (IteratorInputSize) {
                 MemoryAllocator<T>::doConstruct(Objects::getAddress(*IteratorOutput), Objects::doMove(*IteratorInput));
@@ -383,9 +522,7 @@ namespace eLibrary::Core {
         E *ElementContainer = nullptr;
         mutable MemoryAllocator<E> ElementAllocator;
 
-        constexpr Array(E *ElementContainerSource, intmax_t ElementSizeSource) noexcept: ElementSize(ElementSizeSource),
-                                                                                         ElementContainer(
-                                                                                                 ElementContainerSource) {}
+        constexpr Array(E *ElementContainerSource, intmax_t ElementSizeSource, const MemoryAllocator<E> &AllocatorSource) noexcept : ElementSize(ElementSizeSource), ElementContainer(ElementContainerSource), ElementAllocator(AllocatorSource) {}
 
         template<typename ...Es>
         void doInitialize(E ElementCurrent, Es&& ...ElementList) noexcept {
@@ -410,18 +547,18 @@ namespace eLibrary::Core {
             Collections::doCopyConstruct(ElementStart, ElementStop, ElementContainer);
         }
 
-        Array(::std::initializer_list<E> ElementSource): ElementSize(ElementSource.size()) {
+        Array(::std::initializer_list<E> ElementSource, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>()) : ElementSize(ElementSource.size()), ElementAllocator(AllocatorSource) {
             ElementContainer = ElementAllocator.doAllocate(ElementSize);
             Collections::doCopyConstruct(ElementSource.begin(), ElementSource.end(), ElementContainer);
         }
 
-        template<typename ...Es>
+        template<typename ...Es> requires ((Type::isConvertible<Es, E> && !Type::isConvertible<Es, MemoryAllocator<E>>) && ...)
         explicit Array(E ElementCurrent, Es&& ...ElementList) {
             ElementContainer = ElementAllocator.doAllocate(sizeof...(ElementList) + 1);
             doInitialize(Objects::doForward<E>(ElementCurrent), Objects::doForward<Es>(ElementList)...);
         }
 
-        explicit Array(intmax_t ElementSizeSource) : ElementSize(ElementSizeSource) {
+        explicit Array(intmax_t ElementSizeSource, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>()) : ElementSize(ElementSizeSource), ElementAllocator(AllocatorSource) {
             ElementContainer = ElementAllocator.doAllocate(ElementSizeSource);
             for (intmax_t ElementIndex = 0;ElementIndex < ElementSize;++ElementIndex)
                 ElementAllocator.doConstruct(ElementContainer + ElementIndex);
@@ -436,6 +573,7 @@ namespace eLibrary::Core {
         void doAssign(Array &&ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (ElementContainer) ElementAllocator.doDeallocate(ElementContainer, ElementSize);
+            ElementAllocator = ElementSource.ElementAllocator;
             ElementContainer = ElementSource.ElementContainer;
             ElementSource.ElementContainer = nullptr;
             ElementSize = ElementSource.ElementSize;
@@ -445,6 +583,7 @@ namespace eLibrary::Core {
         void doAssign(const Array &ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (ElementContainer) ElementAllocator.doDeallocate(ElementContainer, ElementSize);
+            ElementAllocator = ElementSource.ElementAllocator;
             ElementContainer = ElementAllocator.doAllocate(ElementSize = ElementSource.ElementSize);
             Collections::doCopyConstruct(ElementSource.ElementContainer, ElementSize, ElementContainer);
         }
@@ -457,7 +596,7 @@ namespace eLibrary::Core {
             E *ElementBuffer = ElementAllocator.doAllocate(ElementSize + ElementSource.ElementSize);
             Collections::doCopyConstruct(ElementContainer, ElementSize, ElementBuffer);
             Collections::doCopyConstruct(ElementSource.ElementContainer, ElementSource.ElementSize, ElementBuffer + ElementSize);
-            return {ElementBuffer, ElementSize + ElementSource.ElementSize};
+            return {ElementBuffer, ElementSize + ElementSource.ElementSize, ElementAllocator};
         }
 
         const E &getElement(intmax_t ElementIndex) const {
@@ -482,6 +621,10 @@ namespace eLibrary::Core {
             return ElementSize;
         }
 
+        MemoryResource *getMemoryResource() const noexcept {
+            return ElementAllocator.getMemoryResource();
+        }
+
         bool isEmpty() const noexcept {
             return !ElementSize;
         }
@@ -524,8 +667,7 @@ namespace eLibrary::Core {
         E *ElementContainer = nullptr;
         mutable MemoryAllocator<E> ElementAllocator;
 
-        ArrayList(E *ElementSource, intmax_t ElementSourceSize) noexcept: ElementCapacity(1),
-                                                                          ElementSize(ElementSourceSize) {
+        ArrayList(E *ElementSource, intmax_t ElementSourceSize, const MemoryAllocator<E> &AllocatorSource) noexcept : ElementCapacity(1), ElementSize(ElementSourceSize), ElementAllocator(AllocatorSource) {
             while (ElementCapacity < ElementSourceSize) ElementCapacity <<= 1;
             ElementContainer = ElementAllocator.doAllocate(ElementCapacity);
             Collections::doCopyConstruct(ElementSource, ElementSource + ElementSourceSize, ElementContainer);
@@ -537,6 +679,20 @@ namespace eLibrary::Core {
             if constexpr (sizeof...(ElementList)) doInitialize(Objects::doForward<Es>(ElementList)...);
         }
 
+        void doRelocate(intmax_t ElementCapacityNew) noexcept {
+            if constexpr (Type::isTriviallyRelocatable<E>)
+                ElementContainer = ElementAllocator.doReallocate(ElementContainer, ElementCapacity, ElementCapacityNew);
+            else {
+                E *ElementBuffer = ElementAllocator.doAllocate(ElementCapacityNew);
+                Collections::doMoveConstruct(ElementContainer, ElementSize, ElementBuffer);
+                for (intmax_t ElementIndex = 0;ElementIndex < ElementSize;++ElementIndex)
+                    ElementAllocator.doDestroy(ElementContainer + ElementIndex);
+                ElementAllocator.doDeallocate(ElementContainer, ElementCapacity);
+                ElementContainer = ElementBuffer;
+            }
+            ElementCapacity = ElementCapacityNew;
+        }
+
     public:
         doEnableCopyAssignConstruct(ArrayList)
 
@@ -544,14 +700,23 @@ namespace eLibrary::Core {
 
         constexpr ArrayList() noexcept = default;
 
-        template<typename ...Es>
+        explicit ArrayList(const MemoryAllocator<E> &AllocatorSource) noexcept : ElementAllocator(AllocatorSource) {}
+
+        ArrayList(const ArrayList &ElementSource, const MemoryAllocator<E> &AllocatorSource) noexcept : ElementAllocator(AllocatorSource) {
+            if (!ElementSource.ElementCapacity) return;
+            ElementContainer = ElementAllocator.doAllocate(ElementCapacity = ElementSource.ElementCapacity);
+            Collections::doCopyConstruct(ElementSource.ElementContainer, (ElementSize = ElementSource.ElementSize), ElementContainer);
+        }
+
+        // Resource pointers convert to bool, so they must reach the allocator constructor instead of becoming elements
+        template<typename ...Es> requires ((Type::isConvertible<Es, E> && !Type::isConvertible<Es, MemoryAllocator<E>>) && ...)
         ArrayList(Es&& ...ElementList) : ElementCapacity(1) {
             while ((uintmax_t) ElementCapacity < sizeof...(ElementList)) ElementCapacity <<= 1;
             ElementContainer = ElementAllocator.doAllocate(ElementCapacity);
             doInitialize(Objects::doForward<Es>(ElementList)...);
         }
 
-        ArrayList(::std::initializer_list<E> ElementList) : ElementCapacity(1), ElementSize((intmax_t) ElementList.size()) {
+        ArrayList(::std::initializer_list<E> ElementList, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>()) : ElementCapacity(1), ElementSize((intmax_t) ElementList.size()), ElementAllocator(AllocatorSource) {
             while (ElementCapacity < ElementSize)
                 ElementCapacity <<= 1;
             ElementContainer = ElementAllocator.doAllocate(ElementCapacity);
@@ -559,10 +724,10 @@ namespace eLibrary::Core {
         }
 
         template<typename II>
-        ArrayList(II ElementStart, II ElementStop) : ElementCapacity(1), ElementSize(Collections::getDistance(ElementStart, ElementStop)) {
+        ArrayList(II ElementStart, II ElementStop, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>()) : ElementCapacity(1), ElementSize(Collections::getDistance(ElementStart, ElementStop)), ElementAllocator(AllocatorSource) {
             while (ElementCapacity < ElementSize)
                 ElementCapacity <<= 1;
-            ElementContainer = ElementAllocator.doAllocate(ElementSize);
+            ElementContainer = ElementAllocator.doAllocate(ElementCapacity);
             Collections::doCopyConstruct(ElementStart, ElementStop, ElementContainer);
         }
 
@@ -576,6 +741,12 @@ namespace eLibrary::Core {
             ElementAllocator.doConstruct(ElementContainer + (ElementSize++), ElementSource);
         }
 
+        void addElement(E &&ElementSource) noexcept {
+            if (ElementSize == ElementCapacity)
+                doReserve(ElementCapacity ? ElementCapacity << 1 : 1);
+            ElementAllocator.doConstruct(ElementContainer + (ElementSize++), Objects::doMove(ElementSource));
+        }
+
         void addElement(intmax_t ElementIndex, const E &ElementSource) {
             if (ElementIndex < 0) ElementIndex += ElementSize + 1;
             Collections::doCheckGE(ElementIndex, 0);
@@ -591,6 +762,7 @@ namespace eLibrary::Core {
         void doAssign(ArrayList &&ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             ElementAllocator.doDeallocate(ElementContainer, ElementCapacity);
+            ElementAllocator = ElementSource.ElementAllocator;
             ElementCapacity = ElementSource.ElementCapacity;
             ElementContainer = ElementSource.ElementContainer;
             ElementSize = ElementSource.ElementSize;
@@ -602,9 +774,10 @@ namespace eLibrary::Core {
         void doAssign(const ArrayList &ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             ElementAllocator.doDeallocate(ElementContainer, ElementCapacity);
-            ElementCapacity = ElementSource.ElementCapacity;
-            if (ElementCapacity)
-                ElementContainer = ElementAllocator.doAllocate(ElementCapacity = ElementSource.ElementCapacity);
+            ElementAllocator = ElementSource.ElementAllocator;
+            ElementContainer = nullptr;
+            if ((ElementCapacity = ElementSource.ElementCapacity))
+                ElementContainer = ElementAllocator.doAllocate(ElementCapacity);
             Collections::doCopyConstruct(ElementSource.ElementContainer, (ElementSize = ElementSource.ElementSize),
                                 ElementContainer);
         }
@@ -624,26 +797,17 @@ namespace eLibrary::Core {
             E *ElementBuffer = ElementAllocator.doAllocate(ElementSize + ElementSource.ElementSize);
             Collections::doCopyConstruct(ElementContainer, ElementSize, ElementBuffer);
             Collections::doCopyConstruct(ElementSource.ElementContainer, ElementSource.ElementSize, ElementBuffer + ElementSize);
-            return {ElementBuffer, ElementSize + ElementSource.ElementSize};
+            return {ElementBuffer, ElementSize + ElementSource.ElementSize, ElementAllocator};
         }
 
         void doReserve(intmax_t ElementCapacityNew) noexcept {
-            if (!ElementCapacity) [[unlikely]] ElementContainer = ElementAllocator.doAllocate(ElementCapacity = 1);
-            if (ElementCapacityNew > ElementCapacity) {
-                E *ElementBuffer = ElementAllocator.doAllocate(ElementSize);
-                Collections::doMoveConstruct(ElementContainer, ElementContainer + ElementSize, ElementBuffer);
-                ElementAllocator.doDeallocate(ElementContainer, ElementCapacity);
-                ElementContainer = ElementAllocator.doAllocate(ElementCapacity = ElementCapacityNew);
-                Collections::doMoveConstruct(ElementBuffer, ElementBuffer + ElementSize, ElementContainer);
-                ElementAllocator.doDeallocate(ElementBuffer, ElementSize);
-            }
+            if (ElementCapacityNew > ElementCapacity || !ElementCapacity)
+                doRelocate(Objects::getMaximum(ElementCapacityNew, (intmax_t) 1));
         }
 
         void doReverse() noexcept {
-            E *ElementBuffer = ElementAllocator.doAllocate(ElementSize);
-            Collections::doMoveConstruct(ElementContainer, ElementSize, ElementBuffer);
-            Collections::doMoveReverse(ElementBuffer, ElementBuffer + ElementSize, ElementContainer);
-            ElementAllocator.doDeallocate(ElementBuffer, ElementSize);
+            for (intmax_t ElementIndex = 0;ElementIndex < (ElementSize >> 1);++ElementIndex)
+                Objects::doSwap(ElementContainer[ElementIndex], ElementContainer[ElementSize - ElementIndex - 1]);
         }
 
         const E &getElement(intmax_t ElementIndex) const {
@@ -664,6 +828,10 @@ namespace eLibrary::Core {
             return ElementSize;
         }
 
+        MemoryResource *getMemoryResource() const noexcept {
+            return ElementAllocator.getMemoryResource();
+        }
+
         intmax_t indexOf(const E &ElementSource) const noexcept {
             for (intmax_t ElementIndex = 0; ElementIndex < ElementSize; ++ElementIndex)
                 if (!Objects::doCompare(ElementContainer[ElementIndex], ElementSource)) return ElementIndex;
@@ -693,14 +861,7 @@ namespace eLibrary::Core {
             Collections::doMove(ElementContainer + ElementIndex + 1, ElementContainer + ElementSize,
                                 ElementContainer + ElementIndex);
             if (ElementCapacity == 1) doClear();
-            else if (--ElementSize <= ElementCapacity >> 1) {
-                E *ElementBuffer = ElementAllocator.doAllocate(ElementSize);
-                Collections::doMove(ElementContainer, ElementSize, ElementBuffer);
-                ElementAllocator.doDeallocate(ElementContainer, ElementCapacity);
-                ElementContainer = ElementAllocator.doAllocate(ElementCapacity >>= 1);
-                Collections::doMove(ElementBuffer, ElementSize, ElementContainer);
-                ElementAllocator.doDeallocate(ElementBuffer, ElementSize);
-            }
+            else if (--ElementSize <= ElementCapacity >> 1) doRelocate(ElementCapacity >> 1);
         }
 
         void setElement(intmax_t ElementIndex, const E &ElementSource) {
@@ -940,6 +1101,10 @@ namespace eLibrary::Core {
             ElementContainer.addElement(ElementSource);
         }
 
+        void addBack(E &&ElementSource) noexcept {
+            ElementContainer.addElement(Objects::doMove(ElementSource));
+        }
+
         void addFront(const E &ElementSource) noexcept {
             ElementContainer.addElement(0, ElementSource);
         }
@@ -1115,7 +1280,17 @@ namespace eLibrary::Core {
         using LinkedNode = DoubleLinkedNode<E>;
         LinkedNode *NodeHead = nullptr, *NodeTail = nullptr;
         intmax_t NodeSize = 0;
-        mutable MemoryAllocator<LinkedNode> NodeAllocator;
+        mutable MemoryAllocator<LinkedNode> NodeAllocator{SynchronizedPoolMemoryResource::getInstance()};
+
+        void addNode(LinkedNode *NodeCurrent) noexcept {
+            if (!NodeHead) NodeHead = NodeTail = NodeCurrent;
+            else {
+                NodeTail->NodeNext = NodeCurrent;
+                NodeCurrent->NodePrevious = NodeTail;
+                NodeTail = NodeCurrent;
+            }
+            ++NodeSize;
+        }
 
         template<typename ...Es>
         void doInitialize(E ElementCurrent, Es ...ElementList) noexcept {
@@ -1129,17 +1304,24 @@ namespace eLibrary::Core {
 
         constexpr DoubleLinkedList() noexcept = default;
 
-        template<typename ...Es>
+        explicit DoubleLinkedList(const MemoryAllocator<E> &AllocatorSource) noexcept : NodeAllocator(AllocatorSource) {}
+
+        DoubleLinkedList(const DoubleLinkedList &ElementSource, const MemoryAllocator<E> &AllocatorSource) noexcept : NodeAllocator(AllocatorSource) {
+            for (LinkedNode *NodeCurrent = ElementSource.NodeHead;NodeCurrent;NodeCurrent = NodeCurrent->NodeNext)
+                addElement(NodeCurrent->NodeValue);
+        }
+
+        template<typename ...Es> requires ((Type::isConvertible<Es, E> && !Type::isConvertible<Es, MemoryAllocator<E>>) && ...)
         explicit DoubleLinkedList(Es ...ElementList) noexcept {
             doInitialize(ElementList...);
         }
 
-        DoubleLinkedList(::std::initializer_list<E> ElementList) noexcept: NodeSize(ElementList.size()) {
+        DoubleLinkedList(::std::initializer_list<E> ElementList, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>(SynchronizedPoolMemoryResource::getInstance())) noexcept : NodeAllocator(AllocatorSource) {
             for (const E &ElementCurrent: ElementList) addElement(ElementCurrent);
         }
 
         template<typename II>
-        DoubleLinkedList(II ElementStart, II ElementStop) noexcept {
+        DoubleLinkedList(II ElementStart, II ElementStop, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>(SynchronizedPoolMemoryResource::getInstance())) noexcept : NodeAllocator(AllocatorSource) {
             Collections::doTraverse(ElementStart, ElementStop, [&](const E &ElementCurrent) {
                 addElement(ElementCurrent);
             });
@@ -1150,14 +1332,11 @@ namespace eLibrary::Core {
         }
 
         void addElement(const E &ElementSource) noexcept {
-            auto *NodeCurrent = NodeAllocator.acquireObject(ElementSource);
-            if (!NodeHead) NodeHead = NodeTail = NodeCurrent;
-            else {
-                NodeTail->NodeNext = NodeCurrent;
-                NodeCurrent->NodePrevious = NodeTail;
-                NodeTail = NodeCurrent;
-            }
-            ++NodeSize;
+            addNode(NodeAllocator.acquireObject(ElementSource));
+        }
+
+        void addElement(E &&ElementSource) noexcept {
+            addNode(NodeAllocator.acquireObject(Objects::doMove(ElementSource)));
         }
 
         void addElement(intmax_t ElementIndex, const E &ElementSource) {
@@ -1188,7 +1367,7 @@ namespace eLibrary::Core {
         void doAssign(const DoubleLinkedList &ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (!isEmpty()) doClear();
-            NodeSize = ElementSource.NodeSize;
+            NodeAllocator = ElementSource.NodeAllocator;
             LinkedNode *NodeCurrent = ElementSource.NodeHead;
             while (NodeCurrent) {
                 addElement(NodeCurrent->NodeValue);
@@ -1199,6 +1378,7 @@ namespace eLibrary::Core {
         void doAssign(DoubleLinkedList &&ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (!isEmpty()) doClear();
+            NodeAllocator = ElementSource.NodeAllocator;
             NodeHead = ElementSource.NodeHead;
             NodeSize = ElementSource.NodeSize;
             NodeTail = ElementSource.NodeTail;
@@ -1279,6 +1459,10 @@ namespace eLibrary::Core {
             return NodeSize;
         }
 
+        MemoryResource *getMemoryResource() const noexcept {
+            return NodeAllocator.getMemoryResource();
+        }
+
         intmax_t indexOf(const E &ElementSource) const noexcept {
             intmax_t NodeIndex = 0;
             auto *NodeCurrent(NodeHead);
@@ -1381,81 +1565,138 @@ namespace eLibrary::Core {
         }
     };
 
-    template<typename>
+    template<typename, bool = true>
     class Function final : public Object {};
 
-    template<typename Tr, typename ...Ts>
-    class Function<Tr(Ts...)> final : public Object {
+    /**
+     * Support for type-erased callables, rejecting move-only targets at compile time unless FunctionCopyable is false
+     */
+    template<bool FunctionCopyable, typename Tr, typename ...Ts>
+    class Function<Tr(Ts...), FunctionCopyable> final : public Object {
     private:
-        struct FunctionDescriptorBase {
-        public:
-            virtual ~FunctionDescriptorBase() = default;
+        enum class FunctionOperation {
+            OperationClone, OperationDestroy, OperationMove
+        };
 
-            virtual Tr doCall(Ts...) = 0;
+        static constexpr size_t FunctionStorageSize = 4 * sizeof(void*);
 
-            virtual FunctionDescriptorBase *doClone() const = 0;
-        } *DescriptorHandle = nullptr;
+        union {
+            alignas(::std::max_align_t) uint8_t FunctionStorage[FunctionStorageSize];
+            void *FunctionHandle;
+        };
+        Tr (*FunctionInvoker)(Function*, Ts&&...) = nullptr;
+        void (*FunctionManager)(FunctionOperation, Function*, Function*) = nullptr;
 
         template<typename F>
-        struct FunctionDescriptor : public FunctionDescriptorBase {
-        private:
-            F DescriptorHandle;
-        public:
-            constexpr FunctionDescriptor(F DescriptorHandleSource) noexcept: DescriptorHandle(DescriptorHandleSource) {}
+        static constexpr bool isInline = sizeof(F) <= FunctionStorageSize && alignof(F) <= alignof(::std::max_align_t) && ::std::is_nothrow_move_constructible_v<F>;
 
-            Tr doCall(Ts ...ParameterList) override {
-                return DescriptorHandle(Objects::doForward<Ts>(ParameterList)...);
-            }
+        template<typename F>
+        static constexpr bool isTrivial = isInline<F> && Type::isTriviallyCopyable<F>;
+
+        template<typename F>
+        static F *getCallable(Function *FunctionSource) noexcept {
+            if constexpr (isInline<F>) return ::std::launder(reinterpret_cast<F*>(FunctionSource->FunctionStorage));
+            else return static_cast<F*>(FunctionSource->FunctionHandle);
+        }
 
-            FunctionDescriptorBase *doClone() const override {
-                return new FunctionDescriptor<F>(DescriptorHandle);
+        template<typename F>
+        static Tr doInvoke(Function *FunctionSource, Ts &&...ParameterList) {
+            return (*getCallable<F>(FunctionSource))(Objects::doForward<Ts>(ParameterList)...);
+        }
+
+        template<typename F>
+        static void doManage(FunctionOperation FunctionOperationCurrent, Function *FunctionTarget, Function *FunctionSource) {
+            switch (FunctionOperationCurrent) {
+                case FunctionOperation::OperationClone:
+                    if constexpr (FunctionCopyable) {
+                        if constexpr (isInline<F>) ::new(FunctionTarget->FunctionStorage) F(*getCallable<F>(FunctionSource));
+                        else FunctionTarget->FunctionHandle = new F(*getCallable<F>(FunctionSource));
+                    }
+                    break;
+                case FunctionOperation::OperationDestroy:
+                    if constexpr (isInline<F>) getCallable<F>(FunctionTarget)->~F();
+                    else delete getCallable<F>(FunctionTarget);
+                    break;
+                case FunctionOperation::OperationMove:
+                    if constexpr (isInline<F>) {
+                        ::new(FunctionTarget->FunctionStorage) F(Objects::doMove(*getCallable<F>(FunctionSource)));
+                        getCallable<F>(FunctionSource)->~F();
+                    } else FunctionTarget->FunctionHandle = FunctionSource->FunctionHandle;
+                    break;
             }
-        };
+        }
 
+        void doReset() noexcept {
+            if (FunctionManager) FunctionManager(FunctionOperation::OperationDestroy, this, nullptr);
+            FunctionInvoker = nullptr;
+            FunctionManager = nullptr;
+        }
     public:
-        doEnableCopyAssignConstruct(Function)
-
         doEnableMoveAssignConstruct(Function)
 
-        Function() noexcept : DescriptorHandle(nullptr) {}
+        Function() noexcept : FunctionHandle(nullptr) {}
+
+        Function(const Function &FunctionSource) requires FunctionCopyable : FunctionHandle(nullptr) {
+            doAssign(FunctionSource);
+        }
 
         template<typename F>
-        requires ::std::is_invocable_r_v<Tr, F, Ts...>
-        Function(F FunctionObject) noexcept : DescriptorHandle(new FunctionDescriptor<F>(Objects::doMove(FunctionObject))) {}
+        requires (::std::is_invocable_r_v<Tr, F&, Ts...> && !Type::isSame<F, Function> && (!FunctionCopyable || ::std::is_copy_constructible_v<F>))
+        Function(F FunctionObject) : FunctionInvoker(doInvoke<F>) {
+            if constexpr (isInline<F>) ::new(FunctionStorage) F(Objects::doMove(FunctionObject));
+            else FunctionHandle = new F(Objects::doMove(FunctionObject));
+            if constexpr (!isTrivial<F>) FunctionManager = doManage<F>;
+        }
 
         ~Function() {
-            if (DescriptorHandle) {
-                delete DescriptorHandle;
-                DescriptorHandle = nullptr;
-            }
+            doReset();
         }
 
-        void doAssign(const Function<Tr(Ts...)> &FunctionSource) {
+        void doAssign(const Function &FunctionSource) requires FunctionCopyable {
             if (Objects::getAddress(FunctionSource) == this) return;
-            delete DescriptorHandle;
-            if (FunctionSource.DescriptorHandle) DescriptorHandle = FunctionSource.DescriptorHandle->doClone();
-            else DescriptorHandle = nullptr;
+            doReset();
+            if (FunctionSource.FunctionManager) FunctionSource.FunctionManager(FunctionOperation::OperationClone, this, const_cast<Function*>(Objects::getAddress(FunctionSource)));
+            else ::memcpy(FunctionStorage, FunctionSource.FunctionStorage, FunctionStorageSize);
+            FunctionInvoker = FunctionSource.FunctionInvoker;
+            FunctionManager = FunctionSource.FunctionManager;
         }
 
-        void doAssign(Function<Tr(Ts...)> &&FunctionSource) noexcept {
+        void doAssign(Function &&FunctionSource) noexcept {
             if (Objects::getAddress(FunctionSource) == this) return;
-            DescriptorHandle = FunctionSource.DescriptorHandle;
-            FunctionSource.DescriptorHandle = nullptr;
+            doReset();
+            if (FunctionSource.FunctionManager) FunctionSource.FunctionManager(FunctionOperation::OperationMove, this, Objects::getAddress(FunctionSource));
+            else ::memcpy(FunctionStorage, FunctionSource.FunctionStorage, FunctionStorageSize);
+            FunctionInvoker = FunctionSource.FunctionInvoker;
+            FunctionManager = FunctionSource.FunctionManager;
+            FunctionSource.FunctionInvoker = nullptr;
+            FunctionSource.FunctionManager = nullptr;
         }
 
         Tr doCall(Ts ...FunctionParameter) {
-            if (!DescriptorHandle) [[unlikely]]
-                doThrowChecked(Exception, u"Function<Tr(Ts...)>::doCall(Ts...) DescriptorHandle"_S);
-            return DescriptorHandle->doCall(Objects::doForward<Ts>(FunctionParameter)...);
+            if (!FunctionInvoker) [[unlikely]]
+                doThrowChecked(Exception, u"Function<Tr(Ts...)>::doCall(Ts...) FunctionInvoker"_S);
+            return FunctionInvoker(this, Objects::doForward<Ts>(FunctionParameter)...);
+        }
+
+        bool isEmpty() const noexcept {
+            return !FunctionInvoker;
+        }
+
+        Tr operator()(Ts ...FunctionParameter) {
+            if (!FunctionInvoker) [[unlikely]]
+                doThrowChecked(Exception, u"Function<Tr(Ts...)>::operator()(Ts...) FunctionInvoker"_S);
+            return FunctionInvoker(this, Objects::doForward<Ts>(FunctionParameter)...);
         }
 
-        Tr operator()(Ts &&...FunctionParameter) {
-            if (!DescriptorHandle) [[unlikely]]
-                doThrowChecked(Exception, u"Function<Tr(Ts...)>::operator()(Ts...) DescriptorHandle"_S);
-            return DescriptorHandle->doCall(Objects::doForward<Ts>(FunctionParameter)...);
+        Function &operator=(const Function &FunctionSource) requires FunctionCopyable {
+            doAssign(FunctionSource);
+            return *this;
         }
     };
 
+    template<typename F>
+    using MoveOnlyFunction = Function<F, false>;
+
     class Functions final : public NonConstructable {
     public:
         template<int> struct PlaceHolder {};
@@ -1634,98 +1875,1099 @@ namespace eLibrary::Core {
         }
     };
 
-    template<typename T>
-    class PointerShared final {
-    private:
-        T *PointerObject = nullptr;
-        uintmax_t *PointerReference = nullptr;
+    /**
+     * Support for ordered storage of key-value mappings in wide nodes whose keys are packed contiguously
+     */
+    template<typename K, typename V>
+    class BTree : public Object {
+    protected:
+        static constexpr bool NodeValueless = Type::isSame<V, ::std::nullptr_t>;
+        // Keys of a node fill four cache lines, so a lookup touches a few lines per level instead of one node per key
+        static constexpr uintmax_t NodeCapacity = 256 / sizeof(K) < 4 ? 4 : (256 / sizeof(K) > 32 ? 32 : 256 / sizeof(K));
+        static constexpr uintmax_t NodeMinimum = NodeCapacity / 2;
+
+        template<typename T, uintmax_t N>
+        struct BTreeStorage final {
+            alignas(T) uint8_t StorageContainer[sizeof(T) * N];
+
+            void doDestroy(uintmax_t StorageSize) noexcept {
+                for (uintmax_t StorageIndex = 0;StorageIndex < StorageSize;++StorageIndex)
+                    getData()[StorageIndex].~T();
+            }
 
-        void doRelease() {
-            if (PointerReference && --(*PointerReference) == 0) {
-                delete PointerObject;
-                delete PointerReference;
+            void doInsert(uintmax_t StorageSize, uintmax_t StorageIndex, T &&StorageValue) {
+                T *StorageSource = getData();
+                if constexpr (Type::isTriviallyRelocatable<T>)
+                    ::memmove((void*) (StorageSource + StorageIndex + 1), StorageSource + StorageIndex, (StorageSize - StorageIndex) * sizeof(T));
+                else if (StorageIndex < StorageSize) {
+                    ::new(StorageSource + StorageSize) T(Objects::doMove(StorageSource[StorageSize - 1]));
+                    for (uintmax_t StorageCurrent = StorageSize - 1;StorageCurrent > StorageIndex;--StorageCurrent)
+                        StorageSource[StorageCurrent] = Objects::doMove(StorageSource[StorageCurrent - 1]);
+                    StorageSource[StorageIndex] = Objects::doMove(StorageValue);
+                    return;
+                }
+                ::new(StorageSource + StorageIndex) T(Objects::doMove(StorageValue));
             }
-        }
 
-        PointerShared(T *PointerObjectSource, uintmax_t *PointerReferenceSource) : PointerReference(PointerReferenceSource) {
-            PointerObject = PointerObjectSource;
-        }
-    public:
-        doEnableCopyAssignConstruct(PointerShared)
+            void doRemove(uintmax_t StorageSize, uintmax_t StorageIndex) noexcept {
+                T *StorageSource = getData();
+                if constexpr (Type::isTriviallyRelocatable<T>) {
+                    StorageSource[StorageIndex].~T();
+                    ::memmove((void*) (StorageSource + StorageIndex), StorageSource + StorageIndex + 1, (StorageSize - StorageIndex - 1) * sizeof(T));
+                } else {
+                    for (uintmax_t StorageCurrent = StorageIndex;StorageCurrent + 1 < StorageSize;++StorageCurrent)
+                        StorageSource[StorageCurrent] = Objects::doMove(StorageSource[StorageCurrent + 1]);
+                    StorageSource[StorageSize - 1].~T();
+                }
+            }
 
-        doEnableCopyAssignParameterConstruct(PointerShared, ::std::nullptr_t)
+            static void doTransfer(BTreeStorage &StorageSource, uintmax_t StorageSourceIndex, BTreeStorage &StorageTarget, uintmax_t StorageTargetIndex, uintmax_t StorageSize) noexcept {
+                if constexpr (Type::isTriviallyRelocatable<T>)
+                    ::memcpy((void*) (StorageTarget.getData() + StorageTargetIndex), StorageSource.getData() + StorageSourceIndex, StorageSize * sizeof(T));
+                else for (uintmax_t StorageIndex = 0;StorageIndex < StorageSize;++StorageIndex) {
+                    ::new(StorageTarget.getData() + StorageTargetIndex + StorageIndex) T(Objects::doMove(StorageSource[StorageSourceIndex + StorageIndex]));
+                    StorageSource[StorageSourceIndex + StorageIndex].~T();
+                }
+            }
 
-        doEnableMoveAssignConstruct(PointerShared)
+            T *getData() noexcept {
+                return ::std::launder(reinterpret_cast<T*>(StorageContainer));
+            }
 
-        constexpr PointerShared() noexcept = default;
+            const T *getData() const noexcept {
+                return ::std::launder(reinterpret_cast<const T*>(StorageContainer));
+            }
 
-        template<typename Tp> requires Type::isConvertible<Tp, T>
-        explicit PointerShared(Tp *PointerSource) : PointerObject(PointerSource), PointerReference(new uintmax_t(1)) {}
+            T &operator[](uintmax_t StorageIndex) noexcept {
+                return getData()[StorageIndex];
+            }
 
-        ~PointerShared() {
-            doRelease();
-        }
+            const T &operator[](uintmax_t StorageIndex) const noexcept {
+                return getData()[StorageIndex];
+            }
+        };
 
-        void doAssign(const PointerShared &PointerSource) {
-            if (Objects::getAddress(PointerSource) == this) return;
-            doRelease();
-            PointerObject = PointerSource.PointerObject;
-            PointerReference = PointerSource.PointerReference;
-            ++(*PointerReference);
-        }
+        template<typename T>
+        struct BTreeStorage<T, 0> final {
+            void doDestroy(uintmax_t) noexcept {}
 
-        void doAssign(::std::nullptr_t) {
-            doReset();
-        }
+            void doInsert(uintmax_t, uintmax_t, T&&) noexcept {}
 
-        void doAssign(PointerShared &&PointerSource) {
-            PointerShared(Objects::doMove(PointerSource)).doSwap(*this);
-        }
+            void doRemove(uintmax_t, uintmax_t) noexcept {}
 
-        void doReset() noexcept {
-            PointerShared().doSwap(*this);
-        }
+            static void doTransfer(BTreeStorage&, uintmax_t, BTreeStorage&, uintmax_t, uintmax_t) noexcept {}
 
-        template<typename Tp>
-        void doReset(Tp *PointerSource) noexcept {
-            PointerShared(PointerSource).doSwap(*this);
-        }
+            T operator[](uintmax_t) const noexcept {
+                return T();
+            }
+        };
 
-        void doSwap(PointerShared &PointerSource) noexcept {
-            Objects::doSwap(PointerObject, PointerSource.PointerObject);
-            Objects::doSwap(PointerReference, PointerSource.PointerReference);
-        }
+        struct BTreeNode {
+            uintmax_t NodeSize = 0;
+            bool NodeLeaf;
 
-        uintmax_t getReferenceCount() const noexcept {
-            return PointerReference ? *PointerReference : 0;
-        }
+            constexpr explicit BTreeNode(bool NodeLeafSource) noexcept: NodeLeaf(NodeLeafSource) {}
+        } *NodeRoot = nullptr;
 
-        T *getValue() const noexcept {
-            return PointerObject;
-        }
+        struct BTreeLeaf final : BTreeNode {
+            BTreeStorage<K, NodeCapacity + 1> NodeKey;
+            [[no_unique_address]] BTreeStorage<V, NodeValueless ? 0 : NodeCapacity + 1> NodeValue;
+            BTreeLeaf *NodeNext = nullptr, *NodePrevious = nullptr;
 
-        bool hasValue() const noexcept {
-            return PointerObject;
-        }
+            constexpr BTreeLeaf() noexcept: BTreeNode(true) {}
+        } *NodeHead = nullptr, *NodeTail = nullptr;
 
-        T &operator*() const {
-            if (!hasValue()) [[unlikely]]
-                doThrowChecked(Exception, u"PointerShared::operator*() hasValue"_S);
-            return *PointerObject;
-        }
+        struct BTreeInner final : BTreeNode {
+            BTreeStorage<K, NodeCapacity + 1> NodeKey;
+            BTreeNode *NodeChild[NodeCapacity + 2];
 
-        T *operator->() const noexcept {
-            return PointerObject;
-        }
+            constexpr BTreeInner() noexcept: BTreeNode(false) {}
+        };
 
-        template<typename ...Ts>
-        static PointerShared valueOf(Ts &&...PointerParameter) {
-            return PointerShared(new T(Objects::doForward<Ts>(PointerParameter)...));
-        }
-    };
+        uintmax_t NodeCount = 0;
+        mutable MemoryAllocator<BTreeLeaf> NodeAllocator{SynchronizedPoolMemoryResource::getInstance()};
 
-    template<typename T>
-    class PointerWeak final {
+        void deleteNode(BTreeNode *NodeCurrent) {
+            if (NodeCurrent->NodeLeaf) {
+                auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeCurrent);
+                LeafCurrent->NodeKey.doDestroy(LeafCurrent->NodeSize);
+                LeafCurrent->NodeValue.doDestroy(LeafCurrent->NodeSize);
+                NodeAllocator.releaseObject(LeafCurrent);
+                return;
+            }
+            auto *InnerCurrent = static_cast<BTreeInner*>(NodeCurrent);
+            for (uintmax_t NodeIndex = 0;NodeIndex <= InnerCurrent->NodeSize;++NodeIndex)
+                deleteNode(InnerCurrent->NodeChild[NodeIndex]);
+            InnerCurrent->NodeKey.doDestroy(InnerCurrent->NodeSize);
+            MemoryAllocator<BTreeInner>(NodeAllocator).releaseObject(InnerCurrent);
+        }
+
+        static void doAdvance(const BTreeLeaf *&LeafCurrent, uintmax_t &NodeIndex) noexcept {
+            if (++NodeIndex < LeafCurrent->NodeSize) return;
+            LeafCurrent = LeafCurrent->NodeNext;
+            NodeIndex = 0;
+        }
+
+        /**
+         * Appends a key greater than every key so far into full leaves, leaving the inner levels to doBuild
+         */
+        void doAppend(const K &NodeKey, const V &NodeValue) noexcept {
+            if (!NodeTail || NodeTail->NodeSize == NodeCapacity) {
+                auto *LeafTarget = NodeAllocator.acquireObject();
+                LeafTarget->NodePrevious = NodeTail;
+                if (NodeTail) NodeTail->NodeNext = LeafTarget;
+                else NodeHead = LeafTarget;
+                NodeTail = LeafTarget;
+            }
+            NodeTail->NodeKey.doInsert(NodeTail->NodeSize, NodeTail->NodeSize, Objects::doCopy(NodeKey));
+            NodeTail->NodeValue.doInsert(NodeTail->NodeSize, NodeTail->NodeSize, Objects::doCopy(NodeValue));
+            ++NodeTail->NodeSize;
+            ++NodeCount;
+        }
+
+        /**
+         * Builds the inner levels bottom-up over the leaves filled by doAppend, spreading children evenly so every node keeps its minimum
+         */
+        void doBuild() noexcept {
+            if (!NodeHead) return;
+            if (NodeTail != NodeHead && NodeTail->NodeSize < NodeMinimum) {
+                BTreeLeaf *LeafPrevious = NodeTail->NodePrevious;
+                for (uintmax_t NodeMove = (LeafPrevious->NodeSize - NodeTail->NodeSize) / 2;NodeMove;--NodeMove) {
+                    NodeTail->NodeKey.doInsert(NodeTail->NodeSize, 0, Objects::doMove(LeafPrevious->NodeKey[LeafPrevious->NodeSize - 1]));
+                    NodeTail->NodeValue.doInsert(NodeTail->NodeSize, 0, Objects::doMove(LeafPrevious->NodeValue[LeafPrevious->NodeSize - 1]));
+                    LeafPrevious->NodeKey.doRemove(LeafPrevious->NodeSize, LeafPrevious->NodeSize - 1);
+                    LeafPrevious->NodeValue.doRemove(LeafPrevious->NodeSize, LeafPrevious->NodeSize - 1);
+                    ++NodeTail->NodeSize;
+                    --LeafPrevious->NodeSize;
+                }
+            }
+            uintmax_t LevelCapacity = 0;
+            for (BTreeLeaf *LeafCurrent = NodeHead;LeafCurrent;LeafCurrent = LeafCurrent->NodeNext) ++LevelCapacity;
+            MemoryAllocator<BTreeNode*> LevelAllocator(NodeAllocator);
+            MemoryAllocator<const K*> LevelKeyAllocator(NodeAllocator);
+            BTreeNode **LevelNode = LevelAllocator.doAllocate(LevelCapacity);
+            // The smallest key under each node, which separates it from its left sibling one level up
+            const K **LevelKey = LevelKeyAllocator.doAllocate(LevelCapacity);
+            uintmax_t LevelSize = 0;
+            for (BTreeLeaf *LeafCurrent = NodeHead;LeafCurrent;LeafCurrent = LeafCurrent->NodeNext, ++LevelSize) {
+                LevelNode[LevelSize] = LeafCurrent;
+                LevelKey[LevelSize] = LeafCurrent->NodeKey.getData();
+            }
+            while (LevelSize > 1) {
+                uintmax_t InnerCount = (LevelSize + NodeCapacity) / (NodeCapacity + 1), LevelIndex = 0;
+                for (uintmax_t InnerIndex = 0;InnerIndex < InnerCount;++InnerIndex) {
+                    uintmax_t ChildCount = LevelSize / InnerCount + (InnerIndex < LevelSize % InnerCount);
+                    auto *InnerTarget = MemoryAllocator<BTreeInner>(NodeAllocator).acquireObject();
+                    for (uintmax_t ChildIndex = 0;ChildIndex < ChildCount;++ChildIndex) {
+                        InnerTarget->NodeChild[ChildIndex] = LevelNode[LevelIndex + ChildIndex];
+                        if (ChildIndex) InnerTarget->NodeKey.doInsert(ChildIndex - 1, ChildIndex - 1, Objects::doCopy(*LevelKey[LevelIndex + ChildIndex]));
+                    }
+                    InnerTarget->NodeSize = ChildCount - 1;
+                    LevelNode[InnerIndex] = InnerTarget;
+                    LevelKey[InnerIndex] = LevelKey[LevelIndex];
+                    LevelIndex += ChildCount;
+                }
+                LevelSize = InnerCount;
+            }
+            NodeRoot = LevelNode[0];
+            LevelAllocator.doDeallocate(LevelNode, LevelCapacity);
+            LevelKeyAllocator.doDeallocate(LevelKey, LevelCapacity);
+        }
+
+        BTreeNode *doInsertCore(BTreeNode *NodeCurrent, const K &NodeKey, const V &NodeValue, BTreeStorage<K, 1> &NodeSplitKey) noexcept {
+            if (NodeCurrent->NodeLeaf) {
+                auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeCurrent);
+                uintmax_t NodeIndex = getLowerBound(LeafCurrent->NodeKey.getData(), LeafCurrent->NodeSize, NodeKey);
+                if (NodeIndex < LeafCurrent->NodeSize && !Objects::doCompare(LeafCurrent->NodeKey[NodeIndex], NodeKey)) {
+                    if constexpr (!NodeValueless) LeafCurrent->NodeValue[NodeIndex] = NodeValue;
+                    return nullptr;
+                }
+                LeafCurrent->NodeKey.doInsert(LeafCurrent->NodeSize, NodeIndex, Objects::doCopy(NodeKey));
+                LeafCurrent->NodeValue.doInsert(LeafCurrent->NodeSize, NodeIndex, Objects::doCopy(NodeValue));
+                ++NodeCount;
+                if (++LeafCurrent->NodeSize <= NodeCapacity) return nullptr;
+                // Both halves keep at least NodeMinimum keys, the tail leaf included
+                uintmax_t NodeKeep = LeafCurrent->NodeSize / 2;
+                auto *LeafSplit = NodeAllocator.acquireObject();
+                BTreeStorage<K, NodeCapacity + 1>::doTransfer(LeafCurrent->NodeKey, NodeKeep, LeafSplit->NodeKey, 0, LeafCurrent->NodeSize - NodeKeep);
+                decltype(LeafCurrent->NodeValue)::doTransfer(LeafCurrent->NodeValue, NodeKeep, LeafSplit->NodeValue, 0, LeafCurrent->NodeSize - NodeKeep);
+                LeafSplit->NodeSize = LeafCurrent->NodeSize - NodeKeep;
+                LeafCurrent->NodeSize = NodeKeep;
+                LeafSplit->NodeNext = LeafCurrent->NodeNext;
+                LeafSplit->NodePrevious = LeafCurrent;
+                if (LeafCurrent->NodeNext) LeafCurrent->NodeNext->NodePrevious = LeafSplit;
+                else NodeTail = LeafSplit;
+                LeafCurrent->NodeNext = LeafSplit;
+                ::new(NodeSplitKey.getData()) K(LeafSplit->NodeKey[0]);
+                return LeafSplit;
+            }
+            auto *InnerCurrent = static_cast<BTreeInner*>(NodeCurrent);
+            uintmax_t NodeIndex = getUpperBound(InnerCurrent->NodeKey.getData(), InnerCurrent->NodeSize, NodeKey);
+            BTreeStorage<K, 1> NodeChildKey;
+            BTreeNode *NodeChildSplit = doInsertCore(InnerCurrent->NodeChild[NodeIndex], NodeKey, NodeValue, NodeChildKey);
+            if (!NodeChildSplit) return nullptr;
+            InnerCurrent->NodeKey.doInsert(InnerCurrent->NodeSize, NodeIndex, Objects::doMove(NodeChildKey[0]));
+            NodeChildKey.doDestroy(1);
+            ::memmove(InnerCurrent->NodeChild + NodeIndex + 2, InnerCurrent->NodeChild + NodeIndex + 1, (InnerCurrent->NodeSize - NodeIndex) * sizeof(BTreeNode*));
+            InnerCurrent->NodeChild[NodeIndex + 1] = NodeChildSplit;
+            if (++InnerCurrent->NodeSize <= NodeCapacity) return nullptr;
+            uintmax_t NodeKeep = InnerCurrent->NodeSize / 2;
+            auto *InnerSplit = MemoryAllocator<BTreeInner>(NodeAllocator).acquireObject();
+            ::new(NodeSplitKey.getData()) K(Objects::doMove(InnerCurrent->NodeKey[NodeKeep]));
+            InnerCurrent->NodeKey[NodeKeep].~K();
+            BTreeStorage<K, NodeCapacity + 1>::doTransfer(InnerCurrent->NodeKey, NodeKeep + 1, InnerSplit->NodeKey, 0, InnerCurrent->NodeSize - NodeKeep - 1);
+            ::memcpy(InnerSplit->NodeChild, InnerCurrent->NodeChild + NodeKeep + 1, (InnerCurrent->NodeSize - NodeKeep) * sizeof(BTreeNode*));
+            InnerSplit->NodeSize = InnerCurrent->NodeSize - NodeKeep - 1;
+            InnerCurrent->NodeSize = NodeKeep;
+            return InnerSplit;
+        }
+
+        void doMerge(BTreeInner *NodeParent, uintmax_t NodeIndex) noexcept {
+            if (NodeParent->NodeChild[NodeIndex]->NodeLeaf) {
+                auto *LeafTarget = static_cast<BTreeLeaf*>(NodeParent->NodeChild[NodeIndex]), *LeafSource = static_cast<BTreeLeaf*>(NodeParent->NodeChild[NodeIndex + 1]);
+                BTreeStorage<K, NodeCapacity + 1>::doTransfer(LeafSource->NodeKey, 0, LeafTarget->NodeKey, LeafTarget->NodeSize, LeafSource->NodeSize);
+                decltype(LeafSource->NodeValue)::doTransfer(LeafSource->NodeValue, 0, LeafTarget->NodeValue, LeafTarget->NodeSize, LeafSource->NodeSize);
+                LeafTarget->NodeSize += LeafSource->NodeSize;
+                LeafTarget->NodeNext = LeafSource->NodeNext;
+                if (LeafSource->NodeNext) LeafSource->NodeNext->NodePrevious = LeafTarget;
+                else NodeTail = LeafTarget;
+                NodeAllocator.releaseObject(LeafSource);
+            } else {
+                auto *InnerTarget = static_cast<BTreeInner*>(NodeParent->NodeChild[NodeIndex]), *InnerSource = static_cast<BTreeInner*>(NodeParent->NodeChild[NodeIndex + 1]);
+                InnerTarget->NodeKey.doInsert(InnerTarget->NodeSize, InnerTarget->NodeSize, Objects::doMove(NodeParent->NodeKey[NodeIndex]));
+                BTreeStorage<K, NodeCapacity + 1>::doTransfer(InnerSource->NodeKey, 0, InnerTarget->NodeKey, InnerTarget->NodeSize + 1, InnerSource->NodeSize);
+                ::memcpy(InnerTarget->NodeChild + InnerTarget->NodeSize + 1, InnerSource->NodeChild, (InnerSource->NodeSize + 1) * sizeof(BTreeNode*));
+                InnerTarget->NodeSize += InnerSource->NodeSize + 1;
+                MemoryAllocator<BTreeInner>(NodeAllocator).releaseObject(InnerSource);
+            }
+            NodeParent->NodeKey.doRemove(NodeParent->NodeSize, NodeIndex);
+            ::memmove(NodeParent->NodeChild + NodeIndex + 1, NodeParent->NodeChild + NodeIndex + 2, (NodeParent->NodeSize - NodeIndex - 1) * sizeof(BTreeNode*));
+            --NodeParent->NodeSize;
+        }
+
+        void doRebalance(BTreeInner *NodeParent, uintmax_t NodeIndex) noexcept {
+            BTreeNode *NodeLeft = NodeIndex ? NodeParent->NodeChild[NodeIndex - 1] : nullptr;
+            BTreeNode *NodeRight = NodeIndex < NodeParent->NodeSize ? NodeParent->NodeChild[NodeIndex + 1] : nullptr;
+            if (NodeLeft && NodeLeft->NodeSize > NodeMinimum) {
+                if (NodeLeft->NodeLeaf) {
+                    auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeParent->NodeChild[NodeIndex]), *LeafLeft = static_cast<BTreeLeaf*>(NodeLeft);
+                    LeafCurrent->NodeKey.doInsert(LeafCurrent->NodeSize, 0, Objects::doMove(LeafLeft->NodeKey[LeafLeft->NodeSize - 1]));
+                    LeafCurrent->NodeValue.doInsert(LeafCurrent->NodeSize, 0, Objects::doMove(LeafLeft->NodeValue[LeafLeft->NodeSize - 1]));
+                    LeafLeft->NodeKey.doRemove(LeafLeft->NodeSize, LeafLeft->NodeSize - 1);
+                    LeafLeft->NodeValue.doRemove(LeafLeft->NodeSize, LeafLeft->NodeSize - 1);
+                    ++LeafCurrent->NodeSize;
+                    --LeafLeft->NodeSize;
+                    NodeParent->NodeKey[NodeIndex - 1] = LeafCurrent->NodeKey[0];
+                } else {
+                    auto *InnerCurrent = static_cast<BTreeInner*>(NodeParent->NodeChild[NodeIndex]), *InnerLeft = static_cast<BTreeInner*>(NodeLeft);
+                    InnerCurrent->NodeKey.doInsert(InnerCurrent->NodeSize, 0, Objects::doMove(NodeParent->NodeKey[NodeIndex - 1]));
+                    ::memmove(InnerCurrent->NodeChild + 1, InnerCurrent->NodeChild, (InnerCurrent->NodeSize + 1) * sizeof(BTreeNode*));
+                    InnerCurrent->NodeChild[0] = InnerLeft->NodeChild[InnerLeft->NodeSize];
+                    ++InnerCurrent->NodeSize;
+                    NodeParent->NodeKey[NodeIndex - 1] = Objects::doMove(InnerLeft->NodeKey[InnerLeft->NodeSize - 1]);
+                    InnerLeft->NodeKey.doRemove(InnerLeft->NodeSize, InnerLeft->NodeSize - 1);
+                    --InnerLeft->NodeSize;
+                }
+            } else if (NodeRight && NodeRight->NodeSize > NodeMinimum) {
+                if (NodeRight->NodeLeaf) {
+                    auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeParent->NodeChild[NodeIndex]), *LeafRight = static_cast<BTreeLeaf*>(NodeRight);
+                    LeafCurrent->NodeKey.doInsert(LeafCurrent->NodeSize, LeafCurrent->NodeSize, Objects::doMove(LeafRight->NodeKey[0]));
+                    LeafCurrent->NodeValue.doInsert(LeafCurrent->NodeSize, LeafCurrent->NodeSize, Objects::doMove(LeafRight->NodeValue[0]));
+                    LeafRight->NodeKey.doRemove(LeafRight->NodeSize, 0);
+                    LeafRight->NodeValue.doRemove(LeafRight->NodeSize, 0);
+                    ++LeafCurrent->NodeSize;
+                    --LeafRight->NodeSize;
+                    NodeParent->NodeKey[NodeIndex] = LeafRight->NodeKey[0];
+                } else {
+                    auto *InnerCurrent = static_cast<BTreeInner*>(NodeParent->NodeChild[NodeIndex]), *InnerRight = static_cast<BTreeInner*>(NodeRight);
+                    InnerCurrent->NodeKey.doInsert(InnerCurrent->NodeSize, InnerCurrent->NodeSize, Objects::doMove(NodeParent->NodeKey[NodeIndex]));
+                    InnerCurrent->NodeChild[InnerCurrent->NodeSize + 1] = InnerRight->NodeChild[0];
+                    ++InnerCurrent->NodeSize;
+                    NodeParent->NodeKey[NodeIndex] = Objects::doMove(InnerRight->NodeKey[0]);
+                    InnerRight->NodeKey.doRemove(InnerRight->NodeSize, 0);
+                    ::memmove(InnerRight->NodeChild, InnerRight->NodeChild + 1, InnerRight->NodeSize * sizeof(BTreeNode*));
+                    --InnerRight->NodeSize;
+                }
+            } else if (NodeLeft) doMerge(NodeParent, NodeIndex - 1);
+            else doMerge(NodeParent, NodeIndex);
+        }
+
+        bool doRemoveCore(BTreeNode *NodeCurrent, const K &NodeKey) noexcept {
+            if (NodeCurrent->NodeLeaf) {
+                auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeCurrent);
+                uintmax_t NodeIndex = getLowerBound(LeafCurrent->NodeKey.getData(), LeafCurrent->NodeSize, NodeKey);
+                if (NodeIndex == LeafCurrent->NodeSize || Objects::doCompare(LeafCurrent->NodeKey[NodeIndex], NodeKey)) return false;
+                LeafCurrent->NodeKey.doRemove(LeafCurrent->NodeSize, NodeIndex);
+                LeafCurrent->NodeValue.doRemove(LeafCurrent->NodeSize, NodeIndex);
+                --LeafCurrent->NodeSize;
+                --NodeCount;
+                return true;
+            }
+            auto *InnerCurrent = static_cast<BTreeInner*>(NodeCurrent);
+            uintmax_t NodeIndex = getUpperBound(InnerCurrent->NodeKey.getData(), InnerCurrent->NodeSize, NodeKey);
+            if (!doRemoveCore(InnerCurrent->NodeChild[NodeIndex], NodeKey)) return false;
+            if (InnerCurrent->NodeChild[NodeIndex]->NodeSize < NodeMinimum) doRebalance(InnerCurrent, NodeIndex);
+            return true;
+        }
+
+        BTreeLeaf *doSearchCore(const K &NodeKey, uintmax_t &NodeIndex) const noexcept {
+            if (!NodeRoot) return nullptr;
+            BTreeNode *NodeCurrent = NodeRoot;
+            while (!NodeCurrent->NodeLeaf) {
+                auto *InnerCurrent = static_cast<BTreeInner*>(NodeCurrent);
+                NodeCurrent = InnerCurrent->NodeChild[getUpperBound(InnerCurrent->NodeKey.getData(), InnerCurrent->NodeSize, NodeKey)];
+            }
+            auto *LeafCurrent = static_cast<BTreeLeaf*>(NodeCurrent);
+            NodeIndex = getLowerBound(LeafCurrent->NodeKey.getData(), LeafCurrent->NodeSize, NodeKey);
+            if (NodeIndex == LeafCurrent->NodeSize || Objects::doCompare(LeafCurrent->NodeKey[NodeIndex], NodeKey)) return nullptr;
+            return LeafCurrent;
+        }
+
+        static uintmax_t getLowerBound(const K *KeySource, uintmax_t KeySize, const K &NodeKey) noexcept {
+            uintmax_t KeyStart = 0;
+            while (KeySize) {
+                uintmax_t KeyHalf = KeySize / 2;
+                if (Objects::doCompare(KeySource[KeyStart + KeyHalf], NodeKey) < 0) {
+                    KeyStart += KeyHalf + 1;
+                    KeySize -= KeyHalf + 1;
+                } else KeySize = KeyHalf;
+            }
+            return KeyStart;
+        }
+
+        static uintmax_t getUpperBound(const K *KeySource, uintmax_t KeySize, const K &NodeKey) noexcept {
+            uintmax_t KeyStart = 0;
+            while (KeySize) {
+                uintmax_t KeyHalf = KeySize / 2;
+                if (Objects::doCompare(KeySource[KeyStart + KeyHalf], NodeKey) <= 0) {
+                    KeyStart += KeyHalf + 1;
+                    KeySize -= KeyHalf + 1;
+                } else KeySize = KeyHalf;
+            }
+            return KeyStart;
+        }
+    public:
+        doEnableCopyAssignConstruct(BTree)
+
+        doEnableMoveAssignConstruct(BTree)
+
+        constexpr BTree() noexcept = default;
+
+        explicit BTree(MemoryResource *ResourceSource) noexcept : NodeAllocator(ResourceSource) {}
+
+        BTree(const BTree &TreeSource, MemoryResource *ResourceSource) noexcept : NodeAllocator(ResourceSource) {
+            TreeSource.doOrder([&](const K &NodeKeySource, const V &NodeValueSource) {
+                doAppend(NodeKeySource, NodeValueSource);
+            });
+            doBuild();
+        }
+
+        ~BTree() {
+            doClear();
+        }
+
+        void doAssign(const BTree &TreeSource) {
+            if (Objects::getAddress(TreeSource) == this) return;
+            doClear();
+            NodeAllocator = TreeSource.NodeAllocator;
+            TreeSource.doOrder([&](const K &NodeKeySource, const V &NodeValueSource) {
+                doAppend(NodeKeySource, NodeValueSource);
+            });
+            doBuild();
+        }
+
+        void doAssign(BTree &&TreeSource) {
+            if (Objects::getAddress(TreeSource) == this) return;
+            doClear();
+            NodeAllocator = TreeSource.NodeAllocator;
+            NodeRoot = TreeSource.NodeRoot;
+            NodeHead = TreeSource.NodeHead;
+            NodeTail = TreeSource.NodeTail;
+            NodeCount = TreeSource.NodeCount;
+            TreeSource.NodeRoot = nullptr;
+            TreeSource.NodeHead = TreeSource.NodeTail = nullptr;
+            TreeSource.NodeCount = 0;
+        }
+
+        void doClear() {
+            if (NodeRoot) deleteNode(NodeRoot);
+            NodeRoot = nullptr;
+            NodeHead = NodeTail = nullptr;
+            NodeCount = 0;
+        }
+
+        void doInsert(const K &NodeKey, const V &NodeValue) noexcept {
+            if (!NodeRoot) NodeRoot = NodeHead = NodeTail = NodeAllocator.acquireObject();
+            BTreeStorage<K, 1> NodeSplitKey;
+            BTreeNode *NodeSplit = doInsertCore(NodeRoot, NodeKey, NodeValue, NodeSplitKey);
+            if (!NodeSplit) return;
+            auto *InnerRoot = MemoryAllocator<BTreeInner>(NodeAllocator).acquireObject();
+            InnerRoot->NodeKey.doInsert(0, 0, Objects::doMove(NodeSplitKey[0]));
+            NodeSplitKey.doDestroy(1);
+            InnerRoot->NodeChild[0] = NodeRoot;
+            InnerRoot->NodeChild[1] = NodeSplit;
+            InnerRoot->NodeSize = 1;
+            NodeRoot = InnerRoot;
+        }
+
+        template<typename F>
+        void doOrder(F Operation) const {
+            for (const BTreeLeaf *LeafCurrent = NodeHead;LeafCurrent;LeafCurrent = LeafCurrent->NodeNext)
+                for (uintmax_t NodeIndex = 0;NodeIndex < LeafCurrent->NodeSize;++NodeIndex)
+                    Operation(LeafCurrent->NodeKey[NodeIndex], LeafCurrent->NodeValue[NodeIndex]);
+        }
+
+        void doRemove(const K &NodeKey) noexcept {
+            if (!NodeRoot || !doRemoveCore(NodeRoot, NodeKey) || NodeRoot->NodeSize) return;
+            BTreeNode *NodeSource = NodeRoot;
+            if (NodeSource->NodeLeaf) {
+                NodeRoot = NodeHead = NodeTail = nullptr;
+                NodeAllocator.releaseObject(static_cast<BTreeLeaf*>(NodeSource));
+            } else {
+                NodeRoot = static_cast<BTreeInner*>(NodeSource)->NodeChild[0];
+                MemoryAllocator<BTreeInner>(NodeAllocator).releaseObject(static_cast<BTreeInner*>(NodeSource));
+            }
+        }
+
+        Optional<V> doSearch(const K &NodeKey) const noexcept {
+            uintmax_t NodeIndex;
+            BTreeLeaf *NodeResult = doSearchCore(NodeKey, NodeIndex);
+            if (NodeResult == nullptr) return {};
+            return {NodeResult->NodeValue[NodeIndex]};
+        }
+
+        uintmax_t getHeight() const noexcept {
+            uintmax_t NodeHeight = 0;
+            for (BTreeNode *NodeCurrent = NodeRoot;NodeCurrent;++NodeHeight)
+                NodeCurrent = NodeCurrent->NodeLeaf ? nullptr : static_cast<BTreeInner*>(NodeCurrent)->NodeChild[0];
+            return NodeHeight;
+        }
+
+        MemoryResource *getMemoryResource() const noexcept {
+            return NodeAllocator.getMemoryResource();
+        }
+
+        uintmax_t getSize() const noexcept {
+            return NodeCount;
+        }
+    };
+
+    template<typename K, typename V>
+    class BTreeMap final : protected BTree<K, V> {
+    public:
+        constexpr BTreeMap() noexcept = default;
+
+        explicit BTreeMap(MemoryResource *ResourceSource) noexcept : BTree<K, V>(ResourceSource) {}
+
+        BTreeMap(const BTreeMap &MapSource, MemoryResource *ResourceSource) noexcept : BTree<K, V>(MapSource, ResourceSource) {}
+
+        using BTree<K, V>::doClear;
+
+        using BTree<K, V>::doOrder;
+
+        const char *getClassName() const noexcept {
+            return "BTreeMap";
+        }
+
+        const V &getElement(const K &MapKey) const {
+            uintmax_t MapIndex;
+            auto *MapLeaf = this->doSearchCore(MapKey, MapIndex);
+            if (!MapLeaf) [[unlikely]]
+                doThrowChecked(IndexException, u"BTreeMap<K, V>::getElement(const K&) doSearchCore"_S);
+            return MapLeaf->NodeValue[MapIndex];
+        }
+
+        uintmax_t getElementSize() const noexcept {
+            return this->NodeCount;
+        }
+
+        using BTree<K, V>::getMemoryResource;
+
+        bool isContainsKey(const K &MapKey) const noexcept {
+            uintmax_t MapIndex;
+            return this->doSearchCore(MapKey, MapIndex);
+        }
+
+        bool isContainsValue(const V &MapValue) const noexcept {
+            bool ValueResult = false;
+            this->doOrder([&](const K &, const V &MapValueCurrent) {
+                if (!Objects::doCompare(MapValue, MapValueCurrent)) ValueResult = true;
+            });
+            return ValueResult;
+        }
+
+        bool isEmpty() const noexcept {
+            return !this->NodeCount;
+        }
+
+        void removeMapping(const K &MapKey) {
+            if (!isContainsKey(MapKey)) [[unlikely]]
+                doThrowChecked(IndexException, u"BTreeMap<K, V>::removeMapping(const K&) MapKey"_S);
+            this->doRemove(MapKey);
+        }
+
+        void setMapping(const K &MapKey, const V &MapValue) {
+            this->doInsert(MapKey, MapValue);
+        }
+
+        String toString() const noexcept override {
+            StringBuilder CharacterStream;
+            CharacterStream.addCharacter(u'{');
+            this->doOrder([&](const K &MapKey, const V &MapValue) {
+                CharacterStream.addString(String::valueOf(MapKey));
+                CharacterStream.addCharacter(u':');
+                CharacterStream.addString(String::valueOf(MapValue));
+                CharacterStream.addCharacter(u' ');
+            });
+            CharacterStream.addCharacter(u'}');
+            return CharacterStream.toString();
+        }
+    };
+
+    template<typename E>
+    class BTreeSet final : protected BTree<E, ::std::nullptr_t> {
+    private:
+        using BTreeLeaf = typename BTree<E, ::std::nullptr_t>::BTreeLeaf;
+
+        template<bool MergeLeft, bool MergeBoth, bool MergeRight>
+        BTreeSet doMerge(const BTreeSet &SetSource) const noexcept {
+            BTreeSet SetResult(this->getMemoryResource());
+            const BTreeLeaf *LeafLeft = this->NodeHead, *LeafRight = SetSource.NodeHead;
+            uintmax_t NodeLeft = 0, NodeRight = 0;
+            while ((LeafLeft && (LeafRight || MergeLeft)) || (LeafRight && (LeafLeft || MergeRight))) {
+                intmax_t NodeRelation = !LeafLeft ? 1 : (!LeafRight ? -1 : Objects::doCompare(LeafLeft->NodeKey[NodeLeft], LeafRight->NodeKey[NodeRight]));
+                if (NodeRelation < 0) {
+                    if constexpr (MergeLeft) SetResult.doAppend(LeafLeft->NodeKey[NodeLeft], nullptr);
+                    this->doAdvance(LeafLeft, NodeLeft);
+                } else if (NodeRelation > 0) {
+                    if constexpr (MergeRight) SetResult.doAppend(LeafRight->NodeKey[NodeRight], nullptr);
+                    this->doAdvance(LeafRight, NodeRight);
+                } else {
+                    if constexpr (MergeBoth) SetResult.doAppend(LeafLeft->NodeKey[NodeLeft], nullptr);
+                    this->doAdvance(LeafLeft, NodeLeft);
+                    this->doAdvance(LeafRight, NodeRight);
+                }
+            }
+            SetResult.doBuild();
+            return SetResult;
+        }
+    public:
+        constexpr BTreeSet() noexcept = default;
+
+        explicit BTreeSet(MemoryResource *ResourceSource) noexcept : BTree<E, ::std::nullptr_t>(ResourceSource) {}
+
+        BTreeSet(const BTreeSet &SetSource, MemoryResource *ResourceSource) noexcept : BTree<E, ::std::nullptr_t>(SetSource, ResourceSource) {}
+
+        void addElement(const E &ElementSource) noexcept {
+            this->doInsert(ElementSource, nullptr);
+        }
+
+        using BTree<E, ::std::nullptr_t>::doClear;
+
+        BTreeSet doDifference(const BTreeSet &SetSource) const noexcept {
+            return doMerge<true, false, false>(SetSource);
+        }
+
+        BTreeSet doIntersection(const BTreeSet &SetSource) const noexcept {
+            return doMerge<false, true, false>(SetSource);
+        }
+
+        template<typename F>
+        void doTraverse(F Operation) const {
+            this->doOrder([&](const E &ElementSource, ::std::nullptr_t) {
+                Operation(ElementSource);
+            });
+        }
+
+        BTreeSet doUnion(const BTreeSet &SetSource) const noexcept {
+            return doMerge<true, true, true>(SetSource);
+        }
+
+        const char *getClassName() const noexcept {
+            return "BTreeSet";
+        }
+
+        uintmax_t getElementSize() const noexcept {
+            return this->NodeCount;
+        }
+
+        using BTree<E, ::std::nullptr_t>::getMemoryResource;
+
+        bool isContains(const E &ElementSource) const noexcept {
+            uintmax_t ElementIndex;
+            return this->doSearchCore(ElementSource, ElementIndex);
+        }
+
+        bool isEmpty() const noexcept {
+            return !this->NodeCount;
+        }
+
+        void removeElement(const E &ElementSource) {
+            if (!isContains(ElementSource)) [[unlikely]]
+                doThrowChecked(IndexException, u"BTreeSet<E>::removeElement(const E&) isContains"_S);
+            this->doRemove(ElementSource);
+        }
+
+        String toString() const noexcept override {
+            StringBuilder CharacterStream;
+            CharacterStream.addCharacter(u'{');
+            doTraverse([&](const E &ElementSource) {
+                CharacterStream.addString(String::valueOf(ElementSource));
+                CharacterStream.addCharacter(u' ');
+            });
+            CharacterStream.addCharacter(u'}');
+            return CharacterStream.toString();
+        }
+    };
+
+    /**
+     * Support for open-addressing storage of key-value mappings, probed sixteen control bytes at a time
+     */
+    template<typename K, typename V>
+    class HashTable : public Object {
+    protected:
+        static constexpr uintmax_t GroupSize = 16;
+        static constexpr int8_t ControlDeleted = -2, ControlEmpty = -128;
+
+        struct HashSlot final {
+            K SlotKey;
+            [[no_unique_address]] V SlotValue;
+
+            constexpr HashSlot(const K &SlotKeySource, const V &SlotValueSource) noexcept: SlotKey(SlotKeySource), SlotValue(SlotValueSource) {}
+        };
+
+        int8_t *ControlContainer = nullptr;
+        HashSlot *SlotContainer = nullptr;
+        uintmax_t SlotCapacity = 0, SlotGrowth = 0, SlotSize = 0;
+        mutable MemoryAllocator<HashSlot> SlotAllocator;
+
+        static uint32_t doMatchGroup(const int8_t *GroupSource, int8_t GroupControl) noexcept {
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+            return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) GroupSource), _mm_set1_epi8(GroupControl)));
+#else
+            uint32_t GroupMatch = 0;
+            for (uintmax_t GroupIndex = 0;GroupIndex < GroupSize;++GroupIndex)
+                if (GroupSource[GroupIndex] == GroupControl) GroupMatch |= 1u << GroupIndex;
+            return GroupMatch;
+#endif
+        }
+
+        static uint32_t doMatchGroupFree(const int8_t *GroupSource) noexcept {
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+            return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) GroupSource));
+#else
+            uint32_t GroupMatch = 0;
+            for (uintmax_t GroupIndex = 0;GroupIndex < GroupSize;++GroupIndex)
+                if (GroupSource[GroupIndex] < 0) GroupMatch |= 1u << GroupIndex;
+            return GroupMatch;
+#endif
+        }
+
+        void doRehash(uintmax_t SlotCapacityNew) noexcept {
+            int8_t *ControlSource = ControlContainer;
+            HashSlot *SlotSource = SlotContainer;
+            uintmax_t SlotSourceCapacity = SlotCapacity;
+            MemoryAllocator<int8_t> ControlAllocator(SlotAllocator);
+            ControlContainer = ControlAllocator.doAllocate(SlotCapacityNew);
+            ::memset(ControlContainer, ControlEmpty, SlotCapacityNew);
+            SlotContainer = SlotAllocator.doAllocate(SlotCapacityNew);
+            SlotCapacity = SlotCapacityNew;
+            SlotGrowth = SlotCapacityNew - SlotCapacityNew / 8 - SlotSize;
+            for (uintmax_t SlotIndex = 0;SlotIndex < SlotSourceCapacity;++SlotIndex) {
+                if (ControlSource[SlotIndex] < 0) continue;
+                uintmax_t SlotTarget = getSlotFree(getHash(SlotSource[SlotIndex].SlotKey));
+                ControlContainer[SlotTarget] = ControlSource[SlotIndex];
+                SlotAllocator.doConstruct(SlotContainer + SlotTarget, Objects::doMove(SlotSource[SlotIndex]));
+                SlotAllocator.doDestroy(SlotSource + SlotIndex);
+            }
+            if (SlotSourceCapacity) {
+                ControlAllocator.doDeallocate(ControlSource, SlotSourceCapacity);
+                SlotAllocator.doDeallocate(SlotSource, SlotSourceCapacity);
+            }
+        }
+
+        HashSlot *doSearchCore(const K &SlotKey) const noexcept {
+            if (!SlotSize) return nullptr;
+            uintmax_t SlotHash = getHash(SlotKey), GroupMask = SlotCapacity / GroupSize - 1, GroupIndex = (SlotHash >> 7) & GroupMask;
+            for (uintmax_t GroupProbe = 1;;++GroupProbe) {
+                const int8_t *GroupControl = ControlContainer + GroupIndex * GroupSize;
+                for (uint32_t GroupMatch = doMatchGroup(GroupControl, int8_t(SlotHash & 0x7F));GroupMatch;GroupMatch &= GroupMatch - 1) {
+                    HashSlot *SlotCurrent = SlotContainer + GroupIndex * GroupSize + ::std::countr_zero(GroupMatch);
+                    if (!Objects::doCompare(SlotCurrent->SlotKey, SlotKey)) return SlotCurrent;
+                }
+                if (doMatchGroup(GroupControl, ControlEmpty)) return nullptr;
+                GroupIndex = (GroupIndex + GroupProbe) & GroupMask;
+            }
+        }
+
+        uintmax_t getSlotFree(uintmax_t SlotHash) const noexcept {
+            uintmax_t GroupMask = SlotCapacity / GroupSize - 1, GroupIndex = (SlotHash >> 7) & GroupMask;
+            for (uintmax_t GroupProbe = 1;;++GroupProbe) {
+                if (uint32_t GroupMatch = doMatchGroupFree(ControlContainer + GroupIndex * GroupSize))
+                    return GroupIndex * GroupSize + ::std::countr_zero(GroupMatch);
+                GroupIndex = (GroupIndex + GroupProbe) & GroupMask;
+            }
+        }
+    public:
+        doEnableCopyAssignConstruct(HashTable)
+
+        doEnableMoveAssignConstruct(HashTable)
+
+        constexpr HashTable() noexcept = default;
+
+        explicit HashTable(MemoryResource *ResourceSource) noexcept : SlotAllocator(ResourceSource) {}
+
+        HashTable(const HashTable &TableSource, MemoryResource *ResourceSource) noexcept : SlotAllocator(ResourceSource) {
+            doReserve(TableSource.SlotSize);
+            TableSource.doOrder([&](const K &SlotKeySource, const V &SlotValueSource) {
+                doInsert(SlotKeySource, SlotValueSource);
+            });
+        }
+
+        ~HashTable() {
+            doClear();
+        }
+
+        void doAssign(const HashTable &TableSource) {
+            if (Objects::getAddress(TableSource) == this) return;
+            doClear();
+            SlotAllocator = TableSource.SlotAllocator;
+            if (!TableSource.SlotCapacity) return;
+            ControlContainer = MemoryAllocator<int8_t>(SlotAllocator).doAllocate(TableSource.SlotCapacity);
+            ::memcpy(ControlContainer, TableSource.ControlContainer, TableSource.SlotCapacity);
+            SlotContainer = SlotAllocator.doAllocate(TableSource.SlotCapacity);
+            for (uintmax_t SlotIndex = 0;SlotIndex < TableSource.SlotCapacity;++SlotIndex)
+                if (ControlContainer[SlotIndex] >= 0) SlotAllocator.doConstruct(SlotContainer + SlotIndex, TableSource.SlotContainer[SlotIndex]);
+            SlotCapacity = TableSource.SlotCapacity;
+            SlotGrowth = TableSource.SlotGrowth;
+            SlotSize = TableSource.SlotSize;
+        }
+
+        void doAssign(HashTable &&TableSource) {
+            if (Objects::getAddress(TableSource) == this) return;
+            doClear();
+            SlotAllocator = TableSource.SlotAllocator;
+            ControlContainer = TableSource.ControlContainer;
+            SlotContainer = TableSource.SlotContainer;
+            SlotCapacity = TableSource.SlotCapacity;
+            SlotGrowth = TableSource.SlotGrowth;
+            SlotSize = TableSource.SlotSize;
+            TableSource.ControlContainer = nullptr;
+            TableSource.SlotContainer = nullptr;
+            TableSource.SlotCapacity = TableSource.SlotGrowth = TableSource.SlotSize = 0;
+        }
+
+        void doClear() {
+            if (!SlotCapacity) return;
+            for (uintmax_t SlotIndex = 0;SlotIndex < SlotCapacity;++SlotIndex)
+                if (ControlContainer[SlotIndex] >= 0) SlotAllocator.doDestroy(SlotContainer + SlotIndex);
+            MemoryAllocator<int8_t>(SlotAllocator).doDeallocate(ControlContainer, SlotCapacity);
+            SlotAllocator.doDeallocate(SlotContainer, SlotCapacity);
+            ControlContainer = nullptr;
+            SlotContainer = nullptr;
+            SlotCapacity = SlotGrowth = SlotSize = 0;
+        }
+
+        void doInsert(const K &SlotKey, const V &SlotValue) noexcept {
+            if (HashSlot *SlotTarget = doSearchCore(SlotKey)) {
+                SlotTarget->SlotValue = SlotValue;
+                return;
+            }
+            if (!SlotCapacity) doRehash(GroupSize);
+            else if (!SlotGrowth) doRehash(SlotSize <= SlotCapacity / 2 - SlotCapacity / 16 ? SlotCapacity : SlotCapacity << 1);
+            uintmax_t SlotHash = getHash(SlotKey), SlotTarget = getSlotFree(SlotHash);
+            if (ControlContainer[SlotTarget] == ControlEmpty) --SlotGrowth;
+            ControlContainer[SlotTarget] = int8_t(SlotHash & 0x7F);
+            SlotAllocator.doConstruct(SlotContainer + SlotTarget, SlotKey, SlotValue);
+            ++SlotSize;
+        }
+
+        template<typename F>
+        void doOrder(F Operation) const {
+            for (uintmax_t SlotIndex = 0;SlotIndex < SlotCapacity;++SlotIndex)
+                if (ControlContainer[SlotIndex] >= 0) Operation(SlotContainer[SlotIndex].SlotKey, SlotContainer[SlotIndex].SlotValue);
+        }
+
+        void doRemove(const K &SlotKey) noexcept {
+            HashSlot *SlotTarget = doSearchCore(SlotKey);
+            if (!SlotTarget) return;
+            uintmax_t SlotIndex = SlotTarget - SlotContainer;
+            SlotAllocator.doDestroy(SlotTarget);
+            // A group that still has an empty slot never made a probe sequence continue past it
+            if (doMatchGroup(ControlContainer + SlotIndex / GroupSize * GroupSize, ControlEmpty)) {
+                ControlContainer[SlotIndex] = ControlEmpty;
+                ++SlotGrowth;
+            } else ControlContainer[SlotIndex] = ControlDeleted;
+            --SlotSize;
+        }
+
+        void doReserve(uintmax_t SlotSizeTarget) noexcept {
+            uintmax_t SlotCapacityNew = GroupSize;
+            while (SlotCapacityNew - SlotCapacityNew / 8 < SlotSizeTarget) SlotCapacityNew <<= 1;
+            if (SlotCapacityNew > SlotCapacity) doRehash(SlotCapacityNew);
+        }
+
+        Optional<V> doSearch(const K &SlotKey) const noexcept {
+            HashSlot *SlotResult = doSearchCore(SlotKey);
+            if (SlotResult == nullptr) return {};
+            return {SlotResult->SlotValue};
+        }
+
+        static uintmax_t getHash(const K &SlotKey) noexcept {
+            uintmax_t SlotHash = Objects::getHashCode(SlotKey);
+            SlotHash = (SlotHash ^ (SlotHash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            SlotHash = (SlotHash ^ (SlotHash >> 27)) * 0x94D049BB133111EBULL;
+            return SlotHash ^ (SlotHash >> 31);
+        }
+
+        MemoryResource *getMemoryResource() const noexcept {
+            return SlotAllocator.getMemoryResource();
+        }
+
+        uintmax_t getSize() const noexcept {
+            return SlotSize;
+        }
+    };
+
+    template<typename K, typename V>
+    class HashMap final : protected HashTable<K, V> {
+    public:
+        constexpr HashMap() noexcept = default;
+
+        explicit HashMap(MemoryResource *ResourceSource) noexcept : HashTable<K, V>(ResourceSource) {}
+
+        HashMap(const HashMap &MapSource, MemoryResource *ResourceSource) noexcept : HashTable<K, V>(MapSource, ResourceSource) {}
+
+        using HashTable<K, V>::doClear;
+
+        using HashTable<K, V>::doOrder;
+
+        using HashTable<K, V>::doReserve;
+
+        const char *getClassName() const noexcept {
+            return "HashMap";
+        }
+
+        const V &getElement(const K &MapKey) const {
+            auto *MapSlot = this->doSearchCore(MapKey);
+            if (!MapSlot) [[unlikely]]
+                doThrowChecked(IndexException, u"HashMap<K, V>::getElement(const K&) doSearchCore"_S);
+            return MapSlot->SlotValue;
+        }
+
+        uintmax_t getElementSize() const noexcept {
+            return this->SlotSize;
+        }
+
+        using HashTable<K, V>::getMemoryResource;
+
+        bool isContainsKey(const K &MapKey) const noexcept {
+            return this->doSearchCore(MapKey);
+        }
+
+        bool isContainsValue(const V &MapValue) const noexcept {
+            bool ValueResult = false;
+            this->doOrder([&](const K &, const V &MapValueCurrent) {
+                if (!Objects::doCompare(MapValue, MapValueCurrent)) ValueResult = true;
+            });
+            return ValueResult;
+        }
+
+        bool isEmpty() const noexcept {
+            return !this->SlotSize;
+        }
+
+        void removeMapping(const K &MapKey) {
+            if (!this->doSearchCore(MapKey)) [[unlikely]]
+                doThrowChecked(IndexException, u"HashMap<K, V>::removeMapping(const K&) MapKey"_S);
+            this->doRemove(MapKey);
+        }
+
+        void setMapping(const K &MapKey, const V &MapValue) {
+            this->doInsert(MapKey, MapValue);
+        }
+    };
+
+    template<typename E>
+    class HashSet final : protected HashTable<E, ::std::nullptr_t> {
+    public:
+        constexpr HashSet() noexcept = default;
+
+        explicit HashSet(MemoryResource *ResourceSource) noexcept : HashTable<E, ::std::nullptr_t>(ResourceSource) {}
+
+        HashSet(const HashSet &SetSource, MemoryResource *ResourceSource) noexcept : HashTable<E, ::std::nullptr_t>(SetSource, ResourceSource) {}
+
+        void addElement(const E &ElementSource) noexcept {
+            this->doInsert(ElementSource, nullptr);
+        }
+
+        using HashTable<E, ::std::nullptr_t>::doClear;
+
+        HashSet doDifference(const HashSet &SetSource) const noexcept {
+            HashSet SetResult(this->getMemoryResource());
+            this->doOrder([&](const E &ElementSource, ::std::nullptr_t) {
+                if (!SetSource.isContains(ElementSource)) SetResult.addElement(ElementSource);
+            });
+            return SetResult;
+        }
+
+        HashSet doIntersection(const HashSet &SetSource) const noexcept {
+            // Probe the larger set with the smaller one, but always build the result on this set's resource
+            const HashSet &SetSmaller = SetSource.getElementSize() < getElementSize() ? SetSource : *this;
+            const HashSet &SetLarger = &SetSmaller == this ? SetSource : *this;
+            HashSet SetResult(this->getMemoryResource());
+            SetSmaller.doOrder([&](const E &ElementSource, ::std::nullptr_t) {
+                if (SetLarger.isContains(ElementSource)) SetResult.addElement(ElementSource);
+            });
+            return SetResult;
+        }
+
+        using HashTable<E, ::std::nullptr_t>::doReserve;
+
+        template<typename F>
+        void doTraverse(F Operation) const {
+            this->doOrder([&](const E &ElementSource, ::std::nullptr_t) {
+                Operation(ElementSource);
+            });
+        }
+
+        HashSet doUnion(const HashSet &SetSource) const noexcept {
+            HashSet SetResult(*this, this->getMemoryResource());
+            SetResult.doReserve(getElementSize() + SetSource.getElementSize());
+            SetSource.doTraverse([&](const E &ElementSource) {
+                SetResult.addElement(ElementSource);
+            });
+            return SetResult;
+        }
+
+        const char *getClassName() const noexcept {
+            return "HashSet";
+        }
+
+        uintmax_t getElementSize() const noexcept {
+            return this->SlotSize;
+        }
+
+        using HashTable<E, ::std::nullptr_t>::getMemoryResource;
+
+        bool isContains(const E &ElementSource) const noexcept {
+            return this->doSearchCore(ElementSource);
+        }
+
+        bool isEmpty() const noexcept {
+            return !this->SlotSize;
+        }
+
+        void removeElement(const E &ElementSource) {
+            if (!isContains(ElementSource)) [[unlikely]]
+                doThrowChecked(IndexException, u"HashSet<E>::removeElement(const E&) isContains"_S);
+            this->doRemove(ElementSource);
+        }
+
+        String toString() const noexcept override {
+            StringBuilder CharacterStream;
+            CharacterStream.addCharacter(u'{');
+            doTraverse([&](const E &ElementSource) {
+                CharacterStream.addString(String::valueOf(ElementSource));
+                CharacterStream.addCharacter(u' ');
+            });
+            CharacterStream.addCharacter(u'}');
+            return CharacterStream.toString();
+        }
+    };
+
+    template<typename T>
+    class PointerShared final {
+    private:
+        T *PointerObject = nullptr;
+        uintmax_t *PointerReference = nullptr;
+
+        void doRelease() {
+            if (PointerReference && --(*PointerReference) == 0) {
+                delete PointerObject;
+                delete PointerReference;
+            }
+        }
+
+        PointerShared(T *PointerObjectSource, uintmax_t *PointerReferenceSource) : PointerReference(PointerReferenceSource) {
+            PointerObject = PointerObjectSource;
+        }
+    public:
+        doEnableCopyAssignConstruct(PointerShared)
+
+        doEnableCopyAssignParameterConstruct(PointerShared, ::std::nullptr_t)
+
+        doEnableMoveAssignConstruct(PointerShared)
+
+        constexpr PointerShared() noexcept = default;
+
+        template<typename Tp> requires Type::isConvertible<Tp, T>
+        explicit PointerShared(Tp *PointerSource) : PointerObject(PointerSource), PointerReference(new uintmax_t(1)) {}
+
+        ~PointerShared() {
+            doRelease();
+        }
+
+        void doAssign(const PointerShared &PointerSource) {
+            if (Objects::getAddress(PointerSource) == this) return;
+            doRelease();
+            PointerObject = PointerSource.PointerObject;
+            PointerReference = PointerSource.PointerReference;
+            ++(*PointerReference);
+        }
+
+        void doAssign(::std::nullptr_t) {
+            doReset();
+        }
+
+        void doAssign(PointerShared &&PointerSource) {
+            PointerShared(Objects::doMove(PointerSource)).doSwap(*this);
+        }
+
+        void doReset() noexcept {
+            PointerShared().doSwap(*this);
+        }
+
+        template<typename Tp>
+        void doReset(Tp *PointerSource) noexcept {
+            PointerShared(PointerSource).doSwap(*this);
+        }
+
+        void doSwap(PointerShared &PointerSource) noexcept {
+            Objects::doSwap(PointerObject, PointerSource.PointerObject);
+            Objects::doSwap(PointerReference, PointerSource.PointerReference);
+        }
+
+        uintmax_t getReferenceCount() const noexcept {
+            return PointerReference ? *PointerReference : 0;
+        }
+
+        T *getValue() const noexcept {
+            return PointerObject;
+        }
+
+        bool hasValue() const noexcept {
+            return PointerObject;
+        }
+
+        T &operator*() const {
+            if (!hasValue()) [[unlikely]]
+                doThrowChecked(Exception, u"PointerShared::operator*() hasValue"_S);
+            return *PointerObject;
+        }
+
+        T *operator->() const noexcept {
+            return PointerObject;
+        }
+
+        template<typename ...Ts>
+        static PointerShared valueOf(Ts &&...PointerParameter) {
+            return PointerShared(new T(Objects::doForward<Ts>(PointerParameter)...));
+        }
+    };
+
+    template<typename T>
+    class PointerWeak final {
     private:
         T *PointerObject = nullptr;
         uintmax_t *PointerReference = nullptr;
@@ -1882,7 +3124,7 @@ namespace eLibrary::Core {
 
             constexpr RedBlackNode(const K &NodeKeySource, const V &NodeValueSource) noexcept: NodeKey(NodeKeySource), NodeValue(NodeValueSource), NodeColor(NodeColorEnumeration::ColorRed) {}
         } *NodeRoot = nullptr;
-        mutable MemoryAllocator<RedBlackNode> NodeAllocator;
+        mutable MemoryAllocator<RedBlackNode> NodeAllocator{SynchronizedPoolMemoryResource::getInstance()};
 
         void deleteNode(RedBlackNode *NodeCurrent) {
             if (!NodeCurrent) return;
@@ -1891,12 +3133,48 @@ namespace eLibrary::Core {
             NodeAllocator.releaseObject(NodeCurrent);
         }
 
+        void doBuild(RedBlackNode **NodeContainer, uintmax_t NodeSize) noexcept {
+            doClear();
+            // Sibling subtrees differ by at most one node, so only the bottom level can be partial and is colored red
+            NodeRoot = doBuildCore(NodeContainer, NodeSize, 0, ::std::bit_width(NodeSize + 1) - 1, nullptr);
+        }
+
+        static RedBlackNode *doBuildCore(RedBlackNode **NodeContainer, uintmax_t NodeSize, uintmax_t NodeDepth, uintmax_t NodeDepthRed, RedBlackNode *NodeParent) noexcept {
+            if (!NodeSize) return nullptr;
+            uintmax_t NodeMiddle = NodeSize / 2;
+            RedBlackNode *NodeCurrent = NodeContainer[NodeMiddle];
+            NodeCurrent->NodeColor = NodeDepth == NodeDepthRed ? NodeColorEnumeration::ColorRed : NodeColorEnumeration::ColorBlack;
+            NodeCurrent->NodeParent = NodeParent;
+            NodeCurrent->NodeChildLeft = doBuildCore(NodeContainer, NodeMiddle, NodeDepth + 1, NodeDepthRed, NodeCurrent);
+            NodeCurrent->NodeChildRight = doBuildCore(NodeContainer + NodeMiddle + 1, NodeSize - NodeMiddle - 1, NodeDepth + 1, NodeDepthRed, NodeCurrent);
+            return NodeCurrent;
+        }
+
+        void doCopyCore(const RedBlackTree &TreeSource) noexcept {
+            uintmax_t NodeSize = TreeSource.getSize(), NodeIndex = 0;
+            if (!NodeSize) return;
+            MemoryAllocator<RedBlackNode*> ContainerAllocator(NodeAllocator);
+            RedBlackNode **NodeContainer = ContainerAllocator.doAllocate(NodeSize);
+            TreeSource.doOrderCore(TreeSource.NodeRoot, [&](const K &NodeKeySource, const V &NodeValueSource) {
+                NodeContainer[NodeIndex++] = NodeAllocator.acquireObject(NodeKeySource, NodeValueSource);
+            });
+            doBuild(NodeContainer, NodeSize);
+            ContainerAllocator.doDeallocate(NodeContainer, NodeSize);
+        }
+
         template<typename F>
         static void doOrderCore(RedBlackNode *NodeCurrent, F Operation) {
             if (!NodeCurrent) return;
-            Operation(NodeCurrent->NodeKey, NodeCurrent->NodeValue);
-            doOrderCore(NodeCurrent->NodeChildLeft, Operation);
-            doOrderCore(NodeCurrent->NodeChildRight, Operation);
+            RedBlackNode *NodeStop = NodeCurrent->NodeParent, *NodeChild;
+            NodeCurrent = getNodeMinimum(NodeCurrent);
+            while (NodeCurrent != NodeStop) {
+                Operation(NodeCurrent->NodeKey, NodeCurrent->NodeValue);
+                if (NodeCurrent->NodeChildRight) NodeCurrent = getNodeMinimum(NodeCurrent->NodeChildRight);
+                else do {
+                    NodeChild = NodeCurrent;
+                    NodeCurrent = NodeCurrent->NodeParent;
+                } while (NodeCurrent != NodeStop && NodeCurrent->NodeChildRight == NodeChild);
+            }
         }
 
         void doRotateLeft(RedBlackNode *NodeTarget) noexcept {
@@ -1954,6 +3232,49 @@ namespace eLibrary::Core {
             return getSizeCore(NodeCurrent->NodeChildLeft) + getSizeCore(NodeCurrent->NodeChildRight) + 1;
         }
 
+        RedBlackNode *getNodeBound(const K &NodeKey, bool NodeInclusive) const noexcept {
+            RedBlackNode *NodeCurrent = NodeRoot, *NodeResult = nullptr;
+            while (NodeCurrent) {
+                auto NodeRelation = Objects::doCompare(NodeCurrent->NodeKey, NodeKey);
+                if (NodeRelation < 0 || (!NodeInclusive && !NodeRelation)) NodeCurrent = NodeCurrent->NodeChildRight;
+                else {
+                    NodeResult = NodeCurrent;
+                    NodeCurrent = NodeCurrent->NodeChildLeft;
+                }
+            }
+            return NodeResult;
+        }
+
+        static RedBlackNode *getNodeMaximum(RedBlackNode *NodeCurrent) noexcept {
+            if (NodeCurrent) while (NodeCurrent->NodeChildRight) NodeCurrent = NodeCurrent->NodeChildRight;
+            return NodeCurrent;
+        }
+
+        static RedBlackNode *getNodeMinimum(RedBlackNode *NodeCurrent) noexcept {
+            if (NodeCurrent) while (NodeCurrent->NodeChildLeft) NodeCurrent = NodeCurrent->NodeChildLeft;
+            return NodeCurrent;
+        }
+
+        static RedBlackNode *getNodeNext(RedBlackNode *NodeCurrent) noexcept {
+            if (NodeCurrent->NodeChildRight) return getNodeMinimum(NodeCurrent->NodeChildRight);
+            RedBlackNode *NodeParent = NodeCurrent->NodeParent;
+            while (NodeParent && NodeParent->NodeChildRight == NodeCurrent) {
+                NodeCurrent = NodeParent;
+                NodeParent = NodeParent->NodeParent;
+            }
+            return NodeParent;
+        }
+
+        static RedBlackNode *getNodePrevious(RedBlackNode *NodeCurrent) noexcept {
+            if (NodeCurrent->NodeChildLeft) return getNodeMaximum(NodeCurrent->NodeChildLeft);
+            RedBlackNode *NodeParent = NodeCurrent->NodeParent;
+            while (NodeParent && NodeParent->NodeChildLeft == NodeCurrent) {
+                NodeCurrent = NodeParent;
+                NodeParent = NodeParent->NodeParent;
+            }
+            return NodeParent;
+        }
+
         template<typename, typename>
         friend
         class TreeMap;
@@ -1962,12 +3283,91 @@ namespace eLibrary::Core {
         friend
         class TreeSet;
     public:
+        /**
+         * Iterator over the tree in key order, handing out the mapped values read-only when IteratorConstant is set
+         */
+        template<bool IteratorConstant>
+        class RedBlackIteratorCore final {
+        private:
+            RedBlackNode *NodeCurrent;
+            RedBlackNode *const *NodeRoot;
+
+            template<bool>
+            friend
+            class RedBlackIteratorCore;
+        public:
+            using difference_type = ptrdiff_t;
+            using iterator_category = ::std::bidirectional_iterator_tag;
+            using value_type = K;
+
+            constexpr RedBlackIteratorCore() noexcept: NodeCurrent(nullptr), NodeRoot(nullptr) {}
+
+            constexpr RedBlackIteratorCore(RedBlackNode *NodeSource, RedBlackNode *const *NodeRootSource) noexcept: NodeCurrent(NodeSource), NodeRoot(NodeRootSource) {}
+
+            template<bool IteratorConstantSource> requires (IteratorConstant && !IteratorConstantSource)
+            constexpr RedBlackIteratorCore(const RedBlackIteratorCore<IteratorConstantSource> &IteratorSource) noexcept : NodeCurrent(IteratorSource.NodeCurrent), NodeRoot(IteratorSource.NodeRoot) {}
+
+            RedBlackIteratorCore &operator++() noexcept {
+                NodeCurrent = getNodeNext(NodeCurrent);
+                return *this;
+            }
+
+            RedBlackIteratorCore operator++(int) noexcept {
+                RedBlackNode *NodeBuffer = NodeCurrent;
+                NodeCurrent = getNodeNext(NodeCurrent);
+                return {NodeBuffer, NodeRoot};
+            }
+
+            RedBlackIteratorCore &operator--() noexcept {
+                NodeCurrent = NodeCurrent ? getNodePrevious(NodeCurrent) : getNodeMaximum(*NodeRoot);
+                return *this;
+            }
+
+            RedBlackIteratorCore operator--(int) noexcept {
+                RedBlackNode *NodeBuffer = NodeCurrent;
+                NodeCurrent = NodeCurrent ? getNodePrevious(NodeCurrent) : getNodeMaximum(*NodeRoot);
+                return {NodeBuffer, NodeRoot};
+            }
+
+            const K &operator*() const noexcept {
+                return NodeCurrent->NodeKey;
+            }
+
+            template<bool IteratorConstantSource>
+            bool operator==(const RedBlackIteratorCore<IteratorConstantSource> &IteratorSource) const noexcept {
+                return NodeCurrent == IteratorSource.NodeCurrent;
+            }
+
+            template<bool IteratorConstantSource>
+            bool operator!=(const RedBlackIteratorCore<IteratorConstantSource> &IteratorSource) const noexcept {
+                return NodeCurrent != IteratorSource.NodeCurrent;
+            }
+
+            const K &getKey() const noexcept {
+                return NodeCurrent->NodeKey;
+            }
+
+            ::std::conditional_t<IteratorConstant, const V, V> &getValue() const noexcept {
+                return NodeCurrent->NodeValue;
+            }
+        };
+
+        using RedBlackIterator = RedBlackIteratorCore<false>;
+
+        using RedBlackConstantIterator = RedBlackIteratorCore<true>;
+
         doEnableCopyAssignConstruct(RedBlackTree)
 
         doEnableMoveAssignConstruct(RedBlackTree)
 
         constexpr RedBlackTree() noexcept = default;
 
+        explicit RedBlackTree(MemoryResource *ResourceSource) noexcept : NodeAllocator(ResourceSource) {}
+
+        RedBlackTree(const RedBlackTree &TreeSource, MemoryResource *ResourceSource) noexcept : NodeAllocator(ResourceSource) {
+            doCopyCore(TreeSource);
+        }
+
         ~RedBlackTree() {
             doClear();
         }
@@ -1975,14 +3375,14 @@ namespace eLibrary::Core {
         void doAssign(const RedBlackTree &TreeSource) {
             if (Objects::getAddress(TreeSource) == this) return;
             doClear();
-            TreeSource.doOrderCore(TreeSource.NodeRoot, [&](const K &NodeKeySource, const V &NodeValueSource) {
-                doInsert(NodeKeySource, NodeValueSource);
-            });
+            NodeAllocator = TreeSource.NodeAllocator;
+            doCopyCore(TreeSource);
         }
 
         void doAssign(RedBlackTree &&TreeSource) {
             if (Objects::getAddress(TreeSource) == this) return;
             doClear();
+            NodeAllocator = TreeSource.NodeAllocator;
             NodeRoot = TreeSource.NodeRoot;
             TreeSource.NodeRoot = nullptr;
         }
@@ -2004,6 +3404,7 @@ namespace eLibrary::Core {
                 auto NodeRelation = Objects::doCompare(NodeTarget->NodeKey, NodeParent->NodeKey);
                 if (NodeRelation == 0) {
                     NodeParent->NodeValue = NodeTarget->NodeValue;
+                    NodeAllocator.releaseObject(NodeTarget);
                     return;
                 } else if (NodeRelation > 0) {
                     if (!NodeParent->NodeChildRight) {
@@ -2058,11 +3459,25 @@ namespace eLibrary::Core {
             NodeRoot->NodeColor = NodeColorEnumeration::ColorBlack;
         }
 
+        RedBlackIterator begin() noexcept {
+            return {getNodeMinimum(NodeRoot), &NodeRoot};
+        }
+
+        RedBlackConstantIterator begin() const noexcept {
+            return {getNodeMinimum(NodeRoot), &NodeRoot};
+        }
+
         template<typename F>
         void doOrder(F Operation) const {
             doOrderCore(NodeRoot, Operation);
         }
 
+        template<typename F>
+        void doRange(const K &NodeKeyFrom, const K &NodeKeyTo, F Operation) const {
+            for (RedBlackNode *NodeCurrent = getNodeBound(NodeKeyFrom, true);NodeCurrent && Objects::doCompare(NodeCurrent->NodeKey, NodeKeyTo) < 0;NodeCurrent = getNodeNext(NodeCurrent))
+                Operation(NodeCurrent->NodeKey, NodeCurrent->NodeValue);
+        }
+
         void doRemove(const K &NodeKey) noexcept {
             RedBlackNode *NodeTarget = doSearchCore(NodeRoot, NodeKey);
             if (!NodeTarget) return;
@@ -2173,13 +3588,41 @@ namespace eLibrary::Core {
             return {NodeResult->NodeValue};
         }
 
+        RedBlackIterator end() noexcept {
+            return {nullptr, &NodeRoot};
+        }
+
+        RedBlackConstantIterator end() const noexcept {
+            return {nullptr, &NodeRoot};
+        }
+
         uintmax_t getHeight() const noexcept {
             return NodeRoot ? getHeightCore(NodeRoot) : 0;
         }
 
+        RedBlackIterator getLowerBound(const K &NodeKey) noexcept {
+            return {getNodeBound(NodeKey, true), &NodeRoot};
+        }
+
+        RedBlackConstantIterator getLowerBound(const K &NodeKey) const noexcept {
+            return {getNodeBound(NodeKey, true), &NodeRoot};
+        }
+
+        MemoryResource *getMemoryResource() const noexcept {
+            return NodeAllocator.getMemoryResource();
+        }
+
         uintmax_t getSize() const noexcept {
             return NodeRoot ? getSizeCore(NodeRoot) : 0;
         }
+
+        RedBlackIterator getUpperBound(const K &NodeKey) noexcept {
+            return {getNodeBound(NodeKey, false), &NodeRoot};
+        }
+
+        RedBlackConstantIterator getUpperBound(const K &NodeKey) const noexcept {
+            return {getNodeBound(NodeKey, false), &NodeRoot};
+        }
     };
 
     template<typename T>
@@ -2258,7 +3701,16 @@ namespace eLibrary::Core {
         using LinkedNode = SingleLinkedNode<E>;
         LinkedNode *NodeHead = nullptr, *NodeTail = nullptr;
         intmax_t NodeSize = 0;
-        mutable MemoryAllocator<LinkedNode> NodeAllocator;
+        mutable MemoryAllocator<LinkedNode> NodeAllocator{SynchronizedPoolMemoryResource::getInstance()};
+
+        void addNode(LinkedNode *NodeCurrent) noexcept {
+            if (!NodeHead) NodeHead = NodeTail = NodeCurrent;
+            else {
+                NodeTail->NodeNext = NodeCurrent;
+                NodeTail = NodeCurrent;
+            }
+            ++NodeSize;
+        }
 
         template<typename ...Es>
         void doInitialize(E ElementCurrent, Es ...ElementList) noexcept {
@@ -2272,17 +3724,24 @@ namespace eLibrary::Core {
 
         constexpr SingleLinkedList() noexcept = default;
 
-        template<typename ...Es>
+        explicit SingleLinkedList(const MemoryAllocator<E> &AllocatorSource) noexcept : NodeAllocator(AllocatorSource) {}
+
+        SingleLinkedList(const SingleLinkedList &ElementSource, const MemoryAllocator<E> &AllocatorSource) noexcept : NodeAllocator(AllocatorSource) {
+            for (LinkedNode *NodeCurrent = ElementSource.NodeHead;NodeCurrent;NodeCurrent = NodeCurrent->NodeNext)
+                addElement(NodeCurrent->NodeValue);
+        }
+
+        template<typename ...Es> requires ((Type::isConvertible<Es, E> && !Type::isConvertible<Es, MemoryAllocator<E>>) && ...)
         explicit SingleLinkedList(Es ...ElementList) noexcept {
             doInitialize(ElementList...);
         }
 
-        SingleLinkedList(::std::initializer_list<E> ElementList) noexcept: NodeSize(ElementList.size()) {
+        SingleLinkedList(::std::initializer_list<E> ElementList, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>(SynchronizedPoolMemoryResource::getInstance())) noexcept : NodeAllocator(AllocatorSource) {
             for (const E &ElementCurrent: ElementList) addElement(ElementCurrent);
         }
 
         template<typename II>
-        SingleLinkedList(II ElementStart, II ElementStop) noexcept {
+        SingleLinkedList(II ElementStart, II ElementStop, const MemoryAllocator<E> &AllocatorSource = MemoryAllocator<E>(SynchronizedPoolMemoryResource::getInstance())) noexcept : NodeAllocator(AllocatorSource) {
             Collections::doTraverse(ElementStart, ElementStop, [&](const E &ElementCurrent) {
                 addElement(ElementCurrent);
             });
@@ -2293,13 +3752,11 @@ namespace eLibrary::Core {
         }
 
         void addElement(const E &ElementSource) noexcept {
-            auto *NodeCurrent = NodeAllocator.acquireObject(ElementSource);
-            if (!NodeHead) NodeHead = NodeTail = NodeCurrent;
-            else {
-                NodeTail->NodeNext = NodeCurrent;
-                NodeTail = NodeCurrent;
-            }
-            ++NodeSize;
+            addNode(NodeAllocator.acquireObject(ElementSource));
+        }
+
+        void addElement(E &&ElementSource) noexcept {
+            addNode(NodeAllocator.acquireObject(Objects::doMove(ElementSource)));
         }
 
         void addElement(intmax_t ElementIndex, const E &ElementSource) {
@@ -2327,7 +3784,7 @@ namespace eLibrary::Core {
         void doAssign(const SingleLinkedList &ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (!isEmpty()) doClear();
-            NodeSize = ElementSource.NodeSize;
+            NodeAllocator = ElementSource.NodeAllocator;
             LinkedNode *NodeCurrent = ElementSource.NodeHead;
             while (NodeCurrent) {
                 addElement(NodeCurrent->NodeValue);
@@ -2338,6 +3795,7 @@ namespace eLibrary::Core {
         void doAssign(SingleLinkedList &&ElementSource) noexcept {
             if (Objects::getAddress(ElementSource) == this) return;
             if (!isEmpty()) doClear();
+            NodeAllocator = ElementSource.NodeAllocator;
             NodeHead = ElementSource.NodeHead;
             NodeSize = ElementSource.NodeSize;
             NodeTail = ElementSource.NodeTail;
@@ -2385,6 +3843,10 @@ namespace eLibrary::Core {
             return NodeSize;
         }
 
+        MemoryResource *getMemoryResource() const noexcept {
+            return NodeAllocator.getMemoryResource();
+        }
+
         intmax_t indexOf(const E &ElementSource) const noexcept {
             intmax_t NodeIndex = 0;
             auto *NodeCurrent(NodeHead);
@@ -2471,7 +3933,19 @@ namespace eLibrary::Core {
     template<typename K, typename V>
     class TreeMap final : protected RedBlackTree<K, V> {
     public:
-        const char *getClassName() const noexcept override {
+        constexpr TreeMap() noexcept = default;
+
+        explicit TreeMap(MemoryResource *ResourceSource) noexcept : RedBlackTree<K, V>(ResourceSource) {}
+
+        TreeMap(const TreeMap &MapSource, MemoryResource *ResourceSource) noexcept : RedBlackTree<K, V>(MapSource, ResourceSource) {}
+
+        using RedBlackTree<K, V>::begin;
+
+        using RedBlackTree<K, V>::doRange;
+
+        using RedBlackTree<K, V>::end;
+
+        const char *getClassName() const noexcept {
             return "TreeMap";
         }
 
@@ -2486,11 +3960,17 @@ namespace eLibrary::Core {
             return this->getSize();
         }
 
-        bool isContainsKey(const K &MapKey) const noexcept override {
+        using RedBlackTree<K, V>::getLowerBound;
+
+        using RedBlackTree<K, V>::getMemoryResource;
+
+        using RedBlackTree<K, V>::getUpperBound;
+
+        bool isContainsKey(const K &MapKey) const noexcept {
             return this->doSearchCore(this->NodeRoot, MapKey);
         }
 
-        bool isContainsValue(const V &MapValue) const noexcept override {
+        bool isContainsValue(const V &MapValue) const noexcept {
             bool ValueResult = false;
             this->doOrderCore(this->NodeRoot, [&](const K &, const V &MapValueCurrent) {
                 if (!Objects::doCompare(MapValue, MapValueCurrent)) ValueResult = true;
@@ -2518,48 +3998,95 @@ namespace eLibrary::Core {
     template<typename E>
     class TreeSet final : protected RedBlackTree<E, ::std::nullptr_t> {
     private:
-        static void toString(const typename RedBlackTree<E, ::std::nullptr_t>::RedBlackNode *NodeCurrent,
-                             StringBuilder &CharacterStream) noexcept {
-            if (!NodeCurrent) return;
-            CharacterStream.addString(String::valueOf(NodeCurrent->NodeKey));
-            CharacterStream.addCharacter(u' ');
-            toString(NodeCurrent->NodeChildLeft, CharacterStream);
-            toString(NodeCurrent->NodeChildRight, CharacterStream);
+        using RedBlackNode = typename RedBlackTree<E, ::std::nullptr_t>::RedBlackNode;
+
+        using RedBlackTree<E, ::std::nullptr_t>::doBuild;
+
+        template<bool MergeLeft, bool MergeBoth, bool MergeRight>
+        TreeSet doMerge(const TreeSet &SetSource, uintmax_t SetCapacity) const noexcept {
+            TreeSet SetResult(this->getMemoryResource());
+            if (!SetCapacity) return SetResult;
+            MemoryAllocator<RedBlackNode*> ContainerAllocator(SetResult.NodeAllocator);
+            RedBlackNode **NodeContainer = ContainerAllocator.doAllocate(SetCapacity);
+            RedBlackNode *NodeLeft = this->getNodeMinimum(this->NodeRoot), *NodeRight = this->getNodeMinimum(SetSource.NodeRoot);
+            uintmax_t NodeSize = 0;
+            while ((NodeLeft && (NodeRight || MergeLeft)) || (NodeRight && (NodeLeft || MergeRight))) {
+                intmax_t NodeRelation = !NodeLeft ? 1 : (!NodeRight ? -1 : Objects::doCompare(NodeLeft->NodeKey, NodeRight->NodeKey));
+                if (NodeRelation < 0) {
+                    if constexpr (MergeLeft) NodeContainer[NodeSize++] = SetResult.NodeAllocator.acquireObject(NodeLeft->NodeKey, nullptr);
+                    NodeLeft = this->getNodeNext(NodeLeft);
+                } else if (NodeRelation > 0) {
+                    if constexpr (MergeRight) NodeContainer[NodeSize++] = SetResult.NodeAllocator.acquireObject(NodeRight->NodeKey, nullptr);
+                    NodeRight = this->getNodeNext(NodeRight);
+                } else {
+                    if constexpr (MergeBoth) NodeContainer[NodeSize++] = SetResult.NodeAllocator.acquireObject(NodeLeft->NodeKey, nullptr);
+                    NodeLeft = this->getNodeNext(NodeLeft);
+                    NodeRight = this->getNodeNext(NodeRight);
+                }
+            }
+            SetResult.doBuild(NodeContainer, NodeSize);
+            ContainerAllocator.doDeallocate(NodeContainer, SetCapacity);
+            return SetResult;
         }
-
     public:
+        constexpr TreeSet() noexcept = default;
+
+        explicit TreeSet(MemoryResource *ResourceSource) noexcept : RedBlackTree<E, ::std::nullptr_t>(ResourceSource) {}
+
+        TreeSet(const TreeSet &SetSource, MemoryResource *ResourceSource) noexcept : RedBlackTree<E, ::std::nullptr_t>(SetSource, ResourceSource) {}
+
         void addElement(const E &ElementSource) noexcept {
             this->doInsert(ElementSource, nullptr);
         }
 
+        using RedBlackTree<E, ::std::nullptr_t>::begin;
+
+        template<typename I>
+        void doBuild(I ElementBegin, I ElementEnd) {
+            uintmax_t ElementCapacity = 0, NodeSize = 0;
+            for (I ElementCurrent = ElementBegin;ElementCurrent != ElementEnd;++ElementCurrent) ++ElementCapacity;
+            this->doClear();
+            if (!ElementCapacity) return;
+            MemoryAllocator<RedBlackNode*> ContainerAllocator(this->NodeAllocator);
+            RedBlackNode **NodeContainer = ContainerAllocator.doAllocate(ElementCapacity);
+            for (;ElementBegin != ElementEnd;++ElementBegin) {
+                if (NodeSize) {
+                    intmax_t NodeRelation = Objects::doCompare(NodeContainer[NodeSize - 1]->NodeKey, *ElementBegin);
+                    if (!NodeRelation) continue;
+                    if (NodeRelation > 0) [[unlikely]] {
+                        while (NodeSize) this->NodeAllocator.releaseObject(NodeContainer[--NodeSize]);
+                        ContainerAllocator.doDeallocate(NodeContainer, ElementCapacity);
+                        doThrowChecked(Exception, u"TreeSet<E>::doBuild(I, I) ElementBegin"_S);
+                    }
+                }
+                NodeContainer[NodeSize++] = this->NodeAllocator.acquireObject(*ElementBegin, nullptr);
+            }
+            doBuild(NodeContainer, NodeSize);
+            ContainerAllocator.doDeallocate(NodeContainer, ElementCapacity);
+        }
+
         TreeSet doDifference(const TreeSet &SetSource) const noexcept {
-            TreeSet SetResult;
-            this->doOrderCore(this->NodeRoot, [&](const E &ElementSource, ::std::nullptr_t) {
-                if (!SetSource.isContains(ElementSource)) SetResult.addElement(ElementSource);
-            });
-            return SetResult;
+            return doMerge<true, false, false>(SetSource, this->getSize());
         }
 
         TreeSet doIntersection(const TreeSet &SetSource) const noexcept {
-            TreeSet SetResult;
-            this->doOrderCore(this->NodeRoot, [&](const E &ElementSource, ::std::nullptr_t) {
-                if (SetSource.isContains(ElementSource)) SetResult.addElement(ElementSource);
+            return doMerge<false, true, false>(SetSource, Objects::getMinimum(this->getSize(), SetSource.getSize()));
+        }
+
+        template<typename F>
+        void doRange(const E &ElementFrom, const E &ElementTo, F Operation) const {
+            RedBlackTree<E, ::std::nullptr_t>::doRange(ElementFrom, ElementTo, [&](const E &ElementSource, ::std::nullptr_t) {
+                Operation(ElementSource);
             });
-            return SetResult;
         }
 
         TreeSet doUnion(const TreeSet &SetSource) const noexcept {
-            TreeSet SetResult;
-            this->doOrderCore(this->NodeRoot, [&](const E &ElementSource, ::std::nullptr_t) {
-                SetResult.addElement(ElementSource);
-            });
-            SetSource.doOrderCore(SetSource.NodeRoot, [&](const E &ElementSource, ::std::nullptr_t) {
-                SetResult.addElement(ElementSource);
-            });
-            return SetResult;
+            return doMerge<true, true, true>(SetSource, this->getSize() + SetSource.getSize());
         }
 
-        const char *getClassName() const noexcept override {
+        using RedBlackTree<E, ::std::nullptr_t>::end;
+
+        const char *getClassName() const noexcept {
             return "TreeSet";
         }
 
@@ -2567,6 +4094,12 @@ namespace eLibrary::Core {
             return this->getSize();
         }
 
+        using RedBlackTree<E, ::std::nullptr_t>::getLowerBound;
+
+        using RedBlackTree<E, ::std::nullptr_t>::getMemoryResource;
+
+        using RedBlackTree<E, ::std::nullptr_t>::getUpperBound;
+
         bool isContains(const E &ElementSource) const noexcept {
             return this->doSearchCore(this->NodeRoot, ElementSource);
         }
@@ -2584,7 +4117,10 @@ namespace eLibrary::Core {
         String toString() const noexcept override {
             StringBuilder CharacterStream;
             CharacterStream.addCharacter(u'{');
-            toString(this->NodeRoot, CharacterStream);
+            this->doOrderCore(this->NodeRoot, [&](const E &ElementSource, ::std::nullptr_t) {
+                CharacterStream.addString(String::valueOf(ElementSource));
+                CharacterStream.addCharacter(u' ');
+            });
             CharacterStream.addCharacter(u'}');
             return CharacterStream.toString();
         }
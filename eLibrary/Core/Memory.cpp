@@ -1,4 +1,11 @@
 #include <Core/Exception.hpp>
+#include <unordered_set>
+
+#if eLibrarySystem(Windows)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
 
 namespace eLibrary::Core {
     void *HeapMemoryResource::doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept {
@@ -7,6 +14,210 @@ namespace eLibrary::Core {
         return MemoryResult;
     }
 
+    namespace {
+        ::std::atomic<bool> MappedHugeAvailable{true};
+    }
+
+    void *MappedMemoryResource::doMap(size_t MemorySize) noexcept {
+        size_t MappedSize = getMappedSize(MemorySize);
+#if eLibrarySystem(Windows)
+        void *MappedResult = VirtualAlloc(nullptr, MappedSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+        void *MappedResult = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        // Only sizes already spanning whole huge pages go to hugetlbfs, so doUnmap never has to know which kind of mapping it got
+        if (!(MappedSize & (MappedHugePageSize - 1)) && MappedHugeAvailable.load(::std::memory_order_relaxed)) {
+            MappedResult = mmap(nullptr, MappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (MappedResult == MAP_FAILED) MappedHugeAvailable.store(false, ::std::memory_order_relaxed);
+        }
+#endif
+        if (MappedResult == MAP_FAILED) {
+            MappedResult = mmap(nullptr, MappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            // This path is noexcept, so a failed mapping is reported as a null block
+            if (MappedResult == MAP_FAILED) return nullptr;
+#ifdef MADV_HUGEPAGE
+            if (MappedSize >= MappedHugePageSize) madvise(MappedResult, MappedSize, MADV_HUGEPAGE);
+#endif
+        }
+#endif
+        return MappedResult;
+    }
+
+    void *MappedMemoryResource::doRemap(void *MemorySource, size_t MemorySize, size_t MemorySizeNew) noexcept {
+        size_t MappedSize = getMappedSize(MemorySize), MappedSizeNew = getMappedSize(MemorySizeNew);
+        if (MappedSize == MappedSizeNew) return MemorySource;
+#if defined(MREMAP_MAYMOVE)
+        void *MappedResult = mremap(MemorySource, MappedSize, MappedSizeNew, MREMAP_MAYMOVE);
+        if (MappedResult != MAP_FAILED) return MappedResult;
+#endif
+        void *MemoryResult = doMap(MemorySizeNew);
+        if (!MemoryResult) return nullptr;
+        ::memcpy(MemoryResult, MemorySource, MappedSize < MappedSizeNew ? MappedSize : MappedSizeNew);
+        doUnmap(MemorySource, MemorySize);
+        return MemoryResult;
+    }
+
+    void MappedMemoryResource::doUnmap(void *MemorySource, size_t MemorySize) noexcept {
+#if eLibrarySystem(Windows)
+        (void) MemorySize;
+        VirtualFree(MemorySource, 0, MEM_RELEASE);
+#else
+        munmap(MemorySource, getMappedSize(MemorySize));
+#endif
+    }
+
+    void MonotonicMemoryResource::doExpand(size_t MemorySize, size_t MemoryAlignment) noexcept {
+        size_t BlockSize = sizeof(MonotonicBlock) + MemorySize + MemoryAlignment;
+        while (BlockSizeNext < BlockSize) BlockSizeNext <<= 1;
+        auto *BlockTarget = (MonotonicBlock*) ResourceUpstream->doAcquire(BlockSizeNext, alignof(MonotonicBlock));
+        BlockTarget->BlockNext = BlockHead;
+        BlockTarget->BlockSize = BlockSizeNext;
+        BlockHead = BlockTarget;
+        BlockCurrent = (uint8_t*) (BlockTarget + 1);
+        BlockRemaining = BlockSizeNext - sizeof(MonotonicBlock);
+        BlockSizeNext <<= 1;
+    }
+
+    void MonotonicMemoryResource::doReset() noexcept {
+        while (BlockHead) {
+            MonotonicBlock *BlockNext = BlockHead->BlockNext;
+            ResourceUpstream->doRelease(BlockHead, BlockHead->BlockSize, alignof(MonotonicBlock));
+            BlockHead = BlockNext;
+        }
+        BlockCurrent = BufferInitial;
+        BlockRemaining = BufferInitialSize;
+        BlockSizeNext = BlockSizeInitial;
+    }
+
+    void PoolMemoryResource::doExpand(PoolClass &ClassTarget, size_t BlockSize) noexcept {
+        size_t SlabSizeTarget = Objects::getMaximum(SlabSize, sizeof(PoolSlab) + PoolAlignment + BlockSize);
+        auto *SlabTarget = (PoolSlab*) ResourceUpstream->doAcquire(SlabSizeTarget, PoolAlignment);
+        SlabTarget->SlabNext = SlabHead;
+        SlabTarget->SlabSize = SlabSizeTarget;
+        SlabHead = SlabTarget;
+        size_t SlabOffset = (sizeof(PoolSlab) + PoolAlignment - 1) & ~(PoolAlignment - 1);
+        ClassTarget.ClassCurrent = (uint8_t*) SlabTarget + SlabOffset;
+        ClassTarget.ClassRemaining = SlabSizeTarget - SlabOffset;
+    }
+
+    void PoolMemoryResource::doReset() noexcept {
+        while (SlabHead) {
+            PoolSlab *SlabNext = SlabHead->SlabNext;
+            ResourceUpstream->doRelease(SlabHead, SlabHead->SlabSize, PoolAlignment);
+            SlabHead = SlabNext;
+        }
+        for (PoolClass &ClassCurrent : PoolClassList)
+            ClassCurrent = PoolClass();
+    }
+
+    void StatisticsMemoryResource::doReset() noexcept {
+        for (StatisticsShard &ShardCurrent : ShardList) {
+            ShardCurrent.AcquireCount.store(0, ::std::memory_order_relaxed);
+            ShardCurrent.AcquireSize.store(0, ::std::memory_order_relaxed);
+            ShardCurrent.ReleaseCount.store(0, ::std::memory_order_relaxed);
+            ShardCurrent.ReleaseSize.store(0, ::std::memory_order_relaxed);
+            for (auto &HistogramCurrent : ShardCurrent.HistogramList)
+                HistogramCurrent.store(0, ::std::memory_order_relaxed);
+        }
+        PeakSize.store(LiveSize.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+    }
+
+    StatisticsMemoryResource::StatisticsSnapshot StatisticsMemoryResource::getSnapshot() const noexcept {
+        StatisticsSnapshot SnapshotResult;
+        for (const StatisticsShard &ShardCurrent : ShardList) {
+            SnapshotResult.AcquireCount += ShardCurrent.AcquireCount.load(::std::memory_order_relaxed);
+            SnapshotResult.AcquireSize += ShardCurrent.AcquireSize.load(::std::memory_order_relaxed);
+            SnapshotResult.ReleaseCount += ShardCurrent.ReleaseCount.load(::std::memory_order_relaxed);
+            SnapshotResult.ReleaseSize += ShardCurrent.ReleaseSize.load(::std::memory_order_relaxed);
+            for (size_t HistogramIndex = 0;HistogramIndex < HistogramSize;++HistogramIndex)
+                SnapshotResult.HistogramList[HistogramIndex] += ShardCurrent.HistogramList[HistogramIndex].load(::std::memory_order_relaxed);
+        }
+        intmax_t SizeLive = LiveSize.load(::std::memory_order_relaxed);
+        intmax_t SizePeak = PeakSize.load(::std::memory_order_relaxed);
+        SnapshotResult.LiveSize = (uintmax_t) Objects::getMaximum(SizeLive, (intmax_t) 0);
+        SnapshotResult.PeakSize = (uintmax_t) Objects::getMaximum(Objects::getMaximum(SizePeak, SizeLive), (intmax_t) 0);
+        return SnapshotResult;
+    }
+
+    namespace {
+        ::std::mutex CachingRegistryMutex;
+        uintmax_t CachingRegistrySerial = 0;
+
+        ::std::unordered_set<uintmax_t> &getCachingRegistry() noexcept {
+            static auto *CachingRegistry = new ::std::unordered_set<uintmax_t>();
+            return *CachingRegistry;
+        }
+    }
+
+    namespace {
+        thread_local bool CachingThreadExited = false;
+    }
+
+    struct ThreadCachingMemoryResource::ThreadCacheHolder final {
+        ThreadCache *CacheHead = nullptr;
+
+        ~ThreadCacheHolder() noexcept {
+            CachingThreadExited = true;
+            doExit(CacheHead);
+            CacheHead = nullptr;
+        }
+    };
+
+    ThreadCachingMemoryResource::ThreadCachingMemoryResource(size_t SlabSizeSource, MemoryResource *ResourceUpstreamSource) noexcept : ResourceDepot(SlabSizeSource, ResourceUpstreamSource) {
+        ::std::lock_guard<::std::mutex> RegistryLock(CachingRegistryMutex);
+        getCachingRegistry().insert(ResourceSerial = ++CachingRegistrySerial);
+    }
+
+    ThreadCachingMemoryResource::~ThreadCachingMemoryResource() noexcept {
+        ::std::lock_guard<::std::mutex> RegistryLock(CachingRegistryMutex);
+        getCachingRegistry().erase(ResourceSerial);
+    }
+
+    void ThreadCachingMemoryResource::doExit(ThreadCache *CacheHead) noexcept {
+        ::std::lock_guard<::std::mutex> RegistryLock(CachingRegistryMutex);
+        while (CacheHead) {
+            ThreadCache *CacheNext = CacheHead->CacheNext;
+            if (getCachingRegistry().contains(CacheHead->CacheSerial))
+                for (size_t ClassIndex = 0;ClassIndex < CacheClassCount;++ClassIndex)
+                    CacheHead->CacheOwner->doFlush(CacheHead->CacheMagazineList[ClassIndex], ClassIndex, CacheHead->CacheMagazineList[ClassIndex].MagazineSize);
+            delete CacheHead;
+            CacheHead = CacheNext;
+        }
+    }
+
+    void ThreadCachingMemoryResource::doFlush(CacheMagazine &MagazineTarget, size_t ClassIndex, size_t FlushCount) noexcept {
+        ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+        while (FlushCount--)
+            ResourceDepot.doRelease(MagazineTarget.MagazineData[--MagazineTarget.MagazineSize], (ClassIndex + 1) * CacheAlignment, CacheAlignment);
+    }
+
+    void ThreadCachingMemoryResource::doRefill(CacheMagazine &MagazineTarget, size_t ClassIndex) noexcept {
+        ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+        while (MagazineTarget.MagazineSize < (CacheMagazineCapacity >> 1))
+            MagazineTarget.MagazineData[MagazineTarget.MagazineSize++] = ResourceDepot.doAcquire((ClassIndex + 1) * CacheAlignment, CacheAlignment);
+    }
+
+    ThreadCachingMemoryResource::ThreadCache *ThreadCachingMemoryResource::getThreadCache() noexcept {
+        if (CachingThreadExited) [[unlikely]] return nullptr;
+        static thread_local ThreadCacheHolder CacheHolder;
+        ThreadCache *CacheCurrent = CacheHolder.CacheHead, *CachePrevious = nullptr;
+        if (CacheCurrent && CacheCurrent->CacheSerial == ResourceSerial) [[likely]] return CacheCurrent;
+        while (CacheCurrent && CacheCurrent->CacheSerial != ResourceSerial) {
+            CachePrevious = CacheCurrent;
+            CacheCurrent = CacheCurrent->CacheNext;
+        }
+        if (CacheCurrent) CachePrevious->CacheNext = CacheCurrent->CacheNext;
+        else {
+            // Without a cache of its own the thread falls back to the locked depot
+            if (!(CacheCurrent = new (::std::nothrow) ThreadCache())) return nullptr;
+            CacheCurrent->CacheOwner = this;
+            CacheCurrent->CacheSerial = ResourceSerial;
+        }
+        CacheCurrent->CacheNext = CacheHolder.CacheHead;
+        CacheHolder.CacheHead = CacheCurrent;
+        return CacheCurrent;
+    }
+
     void *NullMemoryResource::doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept {
         doThrowUnchecked(RuntimeException(u"NullMemoryResource::doAcquire(size_t, size_t)"_S));
     }
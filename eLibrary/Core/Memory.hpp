@@ -4,7 +4,11 @@
 #define eLibraryHeaderCoreMemory
 
 #include <Core/Object.hpp>
+#include <atomic>
+#include <bit>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
 #include <new>
 
 namespace eLibrary::Core {
@@ -12,6 +16,15 @@ namespace eLibrary::Core {
     public:
         virtual void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept = 0;
 
+        virtual void *doReacquire(void *MemorySource, size_t MemorySize, size_t MemorySizeNew, size_t MemoryAlignment) noexcept {
+            void *MemoryResult = doAcquire(MemorySizeNew, MemoryAlignment);
+            if (MemorySource) {
+                ::memcpy(MemoryResult, MemorySource, MemorySize < MemorySizeNew ? MemorySize : MemorySizeNew);
+                doRelease(MemorySource, MemorySize, MemoryAlignment);
+            }
+            return MemoryResult;
+        }
+
         virtual void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept = 0;
     };
 
@@ -43,6 +56,413 @@ namespace eLibrary::Core {
         }
     };
 
+    /**
+     * Bump allocation from chained upstream blocks, released all together by doReset
+     */
+    class MonotonicMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    private:
+        struct MonotonicBlock final {
+            MonotonicBlock *BlockNext;
+            size_t BlockSize;
+        } *BlockHead = nullptr;
+        uint8_t *BlockCurrent = nullptr;
+        size_t BlockRemaining = 0;
+        size_t BlockSizeInitial, BlockSizeNext;
+        MemoryResource *ResourceUpstream;
+        uint8_t *const BufferInitial;
+        const size_t BufferInitialSize;
+
+        eLibraryAPI void doExpand(size_t MemorySize, size_t MemoryAlignment) noexcept;
+    public:
+        explicit MonotonicMemoryResource(size_t BlockSizeSource = 4096, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : BlockSizeInitial(BlockSizeSource ? BlockSizeSource : 1), BlockSizeNext(BlockSizeInitial), ResourceUpstream(ResourceUpstreamSource), BufferInitial(nullptr), BufferInitialSize(0) {}
+
+        MonotonicMemoryResource(void *BufferSource, size_t BufferSize, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : BlockCurrent((uint8_t*) BufferSource), BlockRemaining(BufferSize), BlockSizeInitial(BufferSize ? BufferSize : 1), BlockSizeNext(BlockSizeInitial), ResourceUpstream(ResourceUpstreamSource), BufferInitial((uint8_t*) BufferSource), BufferInitialSize(BufferSize) {}
+
+        ~MonotonicMemoryResource() noexcept {
+            doReset();
+        }
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            size_t MemoryPadding = -(uintptr_t) BlockCurrent & (MemoryAlignment - 1);
+            if (!BlockCurrent || MemoryPadding + MemorySize > BlockRemaining) [[unlikely]] {
+                doExpand(MemorySize, MemoryAlignment);
+                MemoryPadding = -(uintptr_t) BlockCurrent & (MemoryAlignment - 1);
+            }
+            void *MemoryResult = BlockCurrent + MemoryPadding;
+            BlockCurrent += MemoryPadding + MemorySize;
+            BlockRemaining -= MemoryPadding + MemorySize;
+            return MemoryResult;
+        }
+
+        void *doReacquire(void *MemorySource, size_t MemorySize, size_t MemorySizeNew, size_t MemoryAlignment) noexcept override {
+            if (MemorySource && (uint8_t*) MemorySource + MemorySize == BlockCurrent && (MemorySizeNew <= MemorySize || MemorySizeNew - MemorySize <= BlockRemaining)) {
+                BlockCurrent = (uint8_t*) MemorySource + MemorySizeNew;
+                BlockRemaining += MemorySize;
+                BlockRemaining -= MemorySizeNew;
+                return MemorySource;
+            }
+            return MemoryResource::doReacquire(MemorySource, MemorySize, MemorySizeNew, MemoryAlignment);
+        }
+
+        void doRelease(void*, size_t, size_t) noexcept override {}
+
+        eLibraryAPI void doReset() noexcept;
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourceUpstream;
+        }
+    };
+
+    /**
+     * Per-size-class free lists carved from upstream slabs, for fixed-size objects such as container nodes
+     */
+    class PoolMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    private:
+        static constexpr size_t PoolAlignment = alignof(::std::max_align_t);
+        static constexpr size_t PoolClassCount = 32;
+
+        struct PoolNode final {
+            PoolNode *NodeNext;
+        };
+
+        struct PoolSlab final {
+            PoolSlab *SlabNext;
+            size_t SlabSize;
+        } *SlabHead = nullptr;
+
+        struct PoolClass final {
+            PoolNode *ClassFree = nullptr;
+            uint8_t *ClassCurrent = nullptr;
+            size_t ClassRemaining = 0;
+        } PoolClassList[PoolClassCount];
+        size_t SlabSize;
+        MemoryResource *ResourceUpstream;
+
+        eLibraryAPI void doExpand(PoolClass &ClassTarget, size_t BlockSize) noexcept;
+
+        static constexpr size_t getClassIndex(size_t MemorySize) noexcept {
+            return MemorySize ? (MemorySize - 1) / PoolAlignment : 0;
+        }
+
+        static constexpr bool isPooled(size_t MemorySize, size_t MemoryAlignment) noexcept {
+            return MemorySize <= PoolAlignment * PoolClassCount && MemoryAlignment <= PoolAlignment;
+        }
+    public:
+        explicit PoolMemoryResource(size_t SlabSizeSource = 65536, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : SlabSize(SlabSizeSource), ResourceUpstream(ResourceUpstreamSource) {}
+
+        ~PoolMemoryResource() noexcept {
+            doReset();
+        }
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!isPooled(MemorySize, MemoryAlignment)) [[unlikely]]
+                return ResourceUpstream->doAcquire(MemorySize, MemoryAlignment);
+            size_t ClassIndex = getClassIndex(MemorySize);
+            PoolClass &ClassTarget = PoolClassList[ClassIndex];
+            if (ClassTarget.ClassFree) {
+                PoolNode *NodeResult = ClassTarget.ClassFree;
+                ClassTarget.ClassFree = NodeResult->NodeNext;
+                return NodeResult;
+            }
+            size_t BlockSize = (ClassIndex + 1) * PoolAlignment;
+            if (ClassTarget.ClassRemaining < BlockSize) [[unlikely]] doExpand(ClassTarget, BlockSize);
+            void *MemoryResult = ClassTarget.ClassCurrent;
+            ClassTarget.ClassCurrent += BlockSize;
+            ClassTarget.ClassRemaining -= BlockSize;
+            return MemoryResult;
+        }
+
+        void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!MemorySource) return;
+            if (!isPooled(MemorySize, MemoryAlignment)) [[unlikely]] {
+                ResourceUpstream->doRelease(MemorySource, MemorySize, MemoryAlignment);
+                return;
+            }
+            PoolClass &ClassTarget = PoolClassList[getClassIndex(MemorySize)];
+            auto *NodeSource = (PoolNode*) MemorySource;
+            NodeSource->NodeNext = ClassTarget.ClassFree;
+            ClassTarget.ClassFree = NodeSource;
+        }
+
+        /**
+         * Returns every slab to the upstream resource, invalidating all outstanding blocks
+         */
+        eLibraryAPI void doReset() noexcept;
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourceUpstream;
+        }
+    };
+
+    class SynchronizedPoolMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    private:
+        PoolMemoryResource ResourcePool;
+        ::std::mutex ResourceMutex;
+    public:
+        explicit SynchronizedPoolMemoryResource(size_t SlabSizeSource = 65536, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : ResourcePool(SlabSizeSource, ResourceUpstreamSource) {}
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+            return ResourcePool.doAcquire(MemorySize, MemoryAlignment);
+        }
+
+        void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+            ResourcePool.doRelease(MemorySource, MemorySize, MemoryAlignment);
+        }
+
+        void doReset() noexcept {
+            ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+            ResourcePool.doReset();
+        }
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourcePool.getUpstreamResource();
+        }
+
+        static SynchronizedPoolMemoryResource *getInstance() noexcept {
+            static SynchronizedPoolMemoryResource *ResourceInstance = new SynchronizedPoolMemoryResource();
+            return ResourceInstance;
+        }
+    };
+
+    /**
+     * Thread-local magazines of freed blocks per size class in front of a shared pool depot,
+     * so that the depot lock is only taken when a magazine runs empty or overflows
+     */
+    class ThreadCachingMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    private:
+        static constexpr size_t CacheAlignment = alignof(::std::max_align_t);
+        static constexpr size_t CacheClassCount = 32;
+        static constexpr size_t CacheMagazineCapacity = 64;
+
+        struct CacheMagazine final {
+            void *MagazineData[CacheMagazineCapacity];
+            size_t MagazineSize = 0;
+        };
+
+        struct ThreadCache final {
+            ThreadCachingMemoryResource *CacheOwner;
+            uintmax_t CacheSerial;
+            ThreadCache *CacheNext;
+            CacheMagazine CacheMagazineList[CacheClassCount];
+        };
+
+        struct ThreadCacheHolder;
+
+        PoolMemoryResource ResourceDepot;
+        ::std::mutex ResourceMutex;
+        uintmax_t ResourceSerial;
+
+        eLibraryAPI static void doExit(ThreadCache *CacheHead) noexcept;
+
+        eLibraryAPI void doFlush(CacheMagazine &MagazineTarget, size_t ClassIndex, size_t FlushCount) noexcept;
+
+        eLibraryAPI void doRefill(CacheMagazine &MagazineTarget, size_t ClassIndex) noexcept;
+
+        static constexpr size_t getClassIndex(size_t MemorySize) noexcept {
+            return MemorySize ? (MemorySize - 1) / CacheAlignment : 0;
+        }
+
+        eLibraryAPI ThreadCache *getThreadCache() noexcept;
+
+        static constexpr bool isCached(size_t MemorySize, size_t MemoryAlignment) noexcept {
+            return MemorySize <= CacheAlignment * CacheClassCount && MemoryAlignment <= CacheAlignment;
+        }
+    public:
+        eLibraryAPI explicit ThreadCachingMemoryResource(size_t SlabSizeSource = 65536, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept;
+
+        eLibraryAPI ~ThreadCachingMemoryResource() noexcept;
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!isCached(MemorySize, MemoryAlignment)) [[unlikely]]
+                return getUpstreamResource()->doAcquire(MemorySize, MemoryAlignment);
+            ThreadCache *CacheTarget = getThreadCache();
+            if (!CacheTarget) [[unlikely]] {
+                ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+                return ResourceDepot.doAcquire(MemorySize, MemoryAlignment);
+            }
+            size_t ClassIndex = getClassIndex(MemorySize);
+            CacheMagazine &MagazineTarget = CacheTarget->CacheMagazineList[ClassIndex];
+            if (!MagazineTarget.MagazineSize) [[unlikely]] doRefill(MagazineTarget, ClassIndex);
+            return MagazineTarget.MagazineData[--MagazineTarget.MagazineSize];
+        }
+
+        void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!MemorySource) return;
+            if (!isCached(MemorySize, MemoryAlignment)) [[unlikely]] {
+                getUpstreamResource()->doRelease(MemorySource, MemorySize, MemoryAlignment);
+                return;
+            }
+            ThreadCache *CacheTarget = getThreadCache();
+            if (!CacheTarget) [[unlikely]] {
+                ::std::lock_guard<::std::mutex> ResourceLock(ResourceMutex);
+                ResourceDepot.doRelease(MemorySource, MemorySize, MemoryAlignment);
+                return;
+            }
+            size_t ClassIndex = getClassIndex(MemorySize);
+            CacheMagazine &MagazineTarget = CacheTarget->CacheMagazineList[ClassIndex];
+            if (MagazineTarget.MagazineSize == CacheMagazineCapacity) [[unlikely]]
+                doFlush(MagazineTarget, ClassIndex, CacheMagazineCapacity >> 1);
+            MagazineTarget.MagazineData[MagazineTarget.MagazineSize++] = MemorySource;
+        }
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourceDepot.getUpstreamResource();
+        }
+
+        static ThreadCachingMemoryResource *getInstance() noexcept {
+            static ThreadCachingMemoryResource *ResourceInstance = new ThreadCachingMemoryResource();
+            return ResourceInstance;
+        }
+    };
+
+    /**
+     * Maps large requests directly from the system, preferring huge pages, and forwards the rest upstream
+     */
+    class MappedMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    private:
+        static constexpr size_t MappedAlignment = 4096;
+        static constexpr size_t MappedHugePageSize = 2097152;
+
+        size_t MappedThreshold;
+        MemoryResource *ResourceUpstream;
+
+        eLibraryAPI static void *doMap(size_t MemorySize) noexcept;
+
+        eLibraryAPI static void *doRemap(void *MemorySource, size_t MemorySize, size_t MemorySizeNew) noexcept;
+
+        eLibraryAPI static void doUnmap(void *MemorySource, size_t MemorySize) noexcept;
+
+        static constexpr size_t getMappedSize(size_t MemorySize) noexcept {
+            return (MemorySize + MappedAlignment - 1) & ~(MappedAlignment - 1);
+        }
+
+        bool isMapped(size_t MemorySize, size_t MemoryAlignment) const noexcept {
+            return MemorySize >= MappedThreshold && MemoryAlignment <= MappedAlignment;
+        }
+    public:
+        explicit MappedMemoryResource(size_t MappedThresholdSource = MappedHugePageSize, MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : MappedThreshold(MappedThresholdSource ? MappedThresholdSource : 1), ResourceUpstream(ResourceUpstreamSource) {}
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (isMapped(MemorySize, MemoryAlignment)) [[unlikely]] return doMap(MemorySize);
+            return ResourceUpstream->doAcquire(MemorySize, MemoryAlignment);
+        }
+
+        void *doReacquire(void *MemorySource, size_t MemorySize, size_t MemorySizeNew, size_t MemoryAlignment) noexcept override {
+            if (MemorySource && isMapped(MemorySize, MemoryAlignment) && isMapped(MemorySizeNew, MemoryAlignment))
+                return doRemap(MemorySource, MemorySize, MemorySizeNew);
+            return MemoryResource::doReacquire(MemorySource, MemorySize, MemorySizeNew, MemoryAlignment);
+        }
+
+        void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!MemorySource) return;
+            if (isMapped(MemorySize, MemoryAlignment)) [[unlikely]] doUnmap(MemorySource, MemorySize);
+            else ResourceUpstream->doRelease(MemorySource, MemorySize, MemoryAlignment);
+        }
+
+        size_t getMappedThreshold() const noexcept {
+            return MappedThreshold;
+        }
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourceUpstream;
+        }
+
+        static MappedMemoryResource *getInstance() noexcept {
+            static MappedMemoryResource *ResourceInstance = new MappedMemoryResource();
+            return ResourceInstance;
+        }
+    };
+
+    /**
+     * Decorator counting the traffic of an upstream resource with relaxed per-thread shard counters and a global live byte counter
+     */
+    class StatisticsMemoryResource final : public MemoryResource, public NonCopyable, public NonMovable {
+    public:
+        static constexpr size_t HistogramSize = 65;
+
+        struct StatisticsSnapshot final {
+            uintmax_t AcquireCount = 0;
+            uintmax_t AcquireSize = 0;
+            uintmax_t ReleaseCount = 0;
+            uintmax_t ReleaseSize = 0;
+            uintmax_t LiveSize = 0;
+            uintmax_t PeakSize = 0;
+            uintmax_t HistogramList[HistogramSize]{};
+        };
+    private:
+        static constexpr size_t ShardCount = 16;
+
+        struct alignas(64) StatisticsShard final {
+            ::std::atomic<uintmax_t> AcquireCount{0};
+            ::std::atomic<uintmax_t> AcquireSize{0};
+            ::std::atomic<uintmax_t> ReleaseCount{0};
+            ::std::atomic<uintmax_t> ReleaseSize{0};
+            ::std::atomic<uintmax_t> HistogramList[HistogramSize]{};
+        };
+
+        StatisticsShard ShardList[ShardCount];
+        // Live bytes are global so memory acquired on one thread and released on another still nets out before the peak is taken
+        alignas(64) ::std::atomic<intmax_t> LiveSize{0};
+        ::std::atomic<intmax_t> PeakSize{0};
+        MemoryResource *ResourceUpstream;
+
+        void doUpdate(intmax_t SizeDelta) noexcept {
+            intmax_t SizeLive = LiveSize.fetch_add(SizeDelta, ::std::memory_order_relaxed) + SizeDelta;
+            intmax_t SizePeak = PeakSize.load(::std::memory_order_relaxed);
+            while (SizePeak < SizeLive && !PeakSize.compare_exchange_weak(SizePeak, SizeLive, ::std::memory_order_relaxed));
+        }
+
+        static StatisticsShard &getShard(StatisticsShard *ShardSource) noexcept {
+            static ::std::atomic<size_t> ShardCounter{0};
+            static thread_local size_t ShardIndex = ShardCounter.fetch_add(1, ::std::memory_order_relaxed) % ShardCount;
+            return ShardSource[ShardIndex];
+        }
+    public:
+        explicit StatisticsMemoryResource(MemoryResource *ResourceUpstreamSource = HeapMemoryResource::getInstance()) noexcept : ResourceUpstream(ResourceUpstreamSource) {}
+
+        void *doAcquire(size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            void *MemoryResult = ResourceUpstream->doAcquire(MemorySize, MemoryAlignment);
+            StatisticsShard &ShardTarget = getShard(ShardList);
+            ShardTarget.AcquireCount.fetch_add(1, ::std::memory_order_relaxed);
+            ShardTarget.AcquireSize.fetch_add(MemorySize, ::std::memory_order_relaxed);
+            ShardTarget.HistogramList[::std::bit_width(MemorySize)].fetch_add(1, ::std::memory_order_relaxed);
+            doUpdate((intmax_t) MemorySize);
+            return MemoryResult;
+        }
+
+        void *doReacquire(void *MemorySource, size_t MemorySize, size_t MemorySizeNew, size_t MemoryAlignment) noexcept override {
+            if (!MemorySource) return doAcquire(MemorySizeNew, MemoryAlignment);
+            void *MemoryResult = ResourceUpstream->doReacquire(MemorySource, MemorySize, MemorySizeNew, MemoryAlignment);
+            StatisticsShard &ShardTarget = getShard(ShardList);
+            ShardTarget.AcquireCount.fetch_add(1, ::std::memory_order_relaxed);
+            ShardTarget.AcquireSize.fetch_add(MemorySizeNew, ::std::memory_order_relaxed);
+            ShardTarget.HistogramList[::std::bit_width(MemorySizeNew)].fetch_add(1, ::std::memory_order_relaxed);
+            ShardTarget.ReleaseCount.fetch_add(1, ::std::memory_order_relaxed);
+            ShardTarget.ReleaseSize.fetch_add(MemorySize, ::std::memory_order_relaxed);
+            doUpdate((intmax_t) MemorySizeNew - (intmax_t) MemorySize);
+            return MemoryResult;
+        }
+
+        void doRelease(void *MemorySource, size_t MemorySize, size_t MemoryAlignment) noexcept override {
+            if (!MemorySource) return;
+            ResourceUpstream->doRelease(MemorySource, MemorySize, MemoryAlignment);
+            StatisticsShard &ShardTarget = getShard(ShardList);
+            ShardTarget.ReleaseCount.fetch_add(1, ::std::memory_order_relaxed);
+            ShardTarget.ReleaseSize.fetch_add(MemorySize, ::std::memory_order_relaxed);
+            doUpdate(-(intmax_t) MemorySize);
+        }
+
+        eLibraryAPI void doReset() noexcept;
+
+        eLibraryAPI StatisticsSnapshot getSnapshot() const noexcept;
+
+        MemoryResource *getUpstreamResource() const noexcept {
+            return ResourceUpstream;
+        }
+    };
+
     template<typename T>
     class MemoryAllocator final : public Object {
     private:
@@ -50,6 +470,9 @@ namespace eLibrary::Core {
     public:
         constexpr MemoryAllocator(MemoryResource *ResourceSource = HeapMemoryResource::getInstance()) noexcept : AllocatorResource(ResourceSource) {}
 
+        template<typename U>
+        MemoryAllocator(const MemoryAllocator<U> &AllocatorSource) noexcept : AllocatorResource(AllocatorSource.getMemoryResource()) {}
+
         template<typename ...Ts>
         auto acquireObject(Ts &&...ObjectParameter) {
             auto *ObjectSource = doAllocate(1);
@@ -87,6 +510,10 @@ namespace eLibrary::Core {
             else if (ObjectSource) ObjectSource->~T();
         }
 
+        T *doReallocate(T *ObjectSource, uintmax_t ObjectSize, uintmax_t ObjectSizeNew) noexcept {
+            return (T*) AllocatorResource->doReacquire(ObjectSource, ObjectSize * sizeof(T), ObjectSizeNew * sizeof(T), alignof(T));
+        }
+
         MemoryResource *getMemoryResource() const noexcept {
             return AllocatorResource;
         }
@@ -34,6 +34,7 @@ namespace eLibrary::Core {
             NumberVector() noexcept = default;
 
             NumberVector(uintmax_t NumberSize, intmax_t NumberValue) : ArrayList<intmax_t>() {
+                doReserve(NumberSize);
                 Collections::doFill(ElementContainer, ElementContainer + (ElementSize = NumberSize), NumberValue);
             }
 
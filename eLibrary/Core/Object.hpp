@@ -86,6 +86,21 @@ namespace eLibrary::Core {
             return &ObjectSource;
         }
 
+        template<ObjectDerived T>
+        static uintmax_t getHashCode(const T &ObjectSource) noexcept {
+            return ObjectSource.hashCode();
+        }
+
+        template<std::integral T>
+        static uintmax_t getHashCode(T ObjectSource) noexcept {
+            return (uintmax_t) ObjectSource;
+        }
+
+        template<typename T>
+        static uintmax_t getHashCode(const T *ObjectSource) noexcept {
+            return (uintmax_t) ObjectSource;
+        }
+
         template<Type::Arithmetic T1, Type::Arithmetic T2>
         static auto getMaximum(T1 Object1, T2 Object2) noexcept {
             return Object1 >= Object2 ? Object1 : Object2;
@@ -1,7 +1,410 @@
 #include <Core/Container.hpp>
 #include <Core/Mathematics.hpp>
 
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if eLibraryCompiler(MSVC)
+#include <intrin.h>
+#endif
+
 namespace eLibrary::Core {
+    namespace {
+        constexpr uint64_t StringHashSecret[4] = {0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull, 0x8EBC6AF09C88C6E3ull, 0x589965CC75374CC3ull};
+
+        constexpr intmax_t StringSearchThreshold = 32;
+
+        uint64_t doMix(uint64_t HashSource1, uint64_t HashSource2) noexcept {
+#if eLibraryCompiler(MSVC)
+            uint64_t HashHigh, HashLow = _umul128(HashSource1, HashSource2, &HashHigh);
+            return HashHigh ^ HashLow;
+#else
+            auto HashResult = (unsigned __int128) HashSource1 * HashSource2;
+            return uint64_t(HashResult >> 64) ^ uint64_t(HashResult);
+#endif
+        }
+
+        /**
+         * Loads four code units into the 16-bit lanes of one word, so that both coders hash identically
+         */
+        uint64_t doLoadHash(const uint8_t *HashSource) noexcept {
+            uint32_t HashValue;
+            ::memcpy(&HashValue, HashSource, sizeof(HashValue));
+            uint64_t HashResult = HashValue;
+            HashResult = (HashResult | HashResult << 16) & 0x0000FFFF0000FFFFull;
+            return (HashResult | HashResult << 8) & 0x00FF00FF00FF00FFull;
+        }
+
+        uint64_t doLoadHash(const char16_t *HashSource) noexcept {
+            uint64_t HashResult;
+            ::memcpy(&HashResult, HashSource, sizeof(HashResult));
+            return HashResult;
+        }
+
+        template<typename T>
+        uint64_t doLoadHash(const T *HashSource, intmax_t HashSize) noexcept {
+            uint64_t HashResult = 0;
+            for (intmax_t HashIndex = 0;HashIndex < HashSize;++HashIndex)
+                HashResult |= uint64_t(HashSource[HashIndex]) << (HashIndex * 16);
+            return HashResult;
+        }
+
+        /**
+         * Hashes code units with wyhash-style multiply-mix rounds, running three independent lanes over long inputs
+         */
+        template<typename T>
+        uint64_t doHash(const T *HashSource, intmax_t HashSize) noexcept {
+            uint64_t HashSeed = StringHashSecret[0] ^ doMix(uint64_t(HashSize) ^ StringHashSecret[1], StringHashSecret[0]);
+            intmax_t HashIndex = 0;
+            if (HashSize > 24) {
+                uint64_t HashSeed1 = HashSeed, HashSeed2 = HashSeed;
+                for (;HashIndex + 24 <= HashSize;HashIndex += 24) {
+                    HashSeed = doMix(doLoadHash(HashSource + HashIndex) ^ StringHashSecret[1], doLoadHash(HashSource + HashIndex + 4) ^ HashSeed);
+                    HashSeed1 = doMix(doLoadHash(HashSource + HashIndex + 8) ^ StringHashSecret[2], doLoadHash(HashSource + HashIndex + 12) ^ HashSeed1);
+                    HashSeed2 = doMix(doLoadHash(HashSource + HashIndex + 16) ^ StringHashSecret[3], doLoadHash(HashSource + HashIndex + 20) ^ HashSeed2);
+                }
+                HashSeed ^= HashSeed1 ^ HashSeed2;
+            }
+            for (;HashIndex + 8 <= HashSize;HashIndex += 8)
+                HashSeed = doMix(doLoadHash(HashSource + HashIndex) ^ StringHashSecret[1], doLoadHash(HashSource + HashIndex + 4) ^ HashSeed);
+            intmax_t HashRemaining = HashSize - HashIndex;
+            uint64_t HashSource1 = HashRemaining >= 4 ? doLoadHash(HashSource + HashIndex) : doLoadHash(HashSource + HashIndex, HashRemaining);
+            uint64_t HashSource2 = HashRemaining > 4 ? doLoadHash(HashSource + HashIndex + 4, HashRemaining - 4) : 0;
+            return doMix(StringHashSecret[1] ^ uint64_t(HashSize), doMix(HashSource1 ^ StringHashSecret[1], HashSource2 ^ HashSeed));
+        }
+
+#if defined(__AVX2__)
+        template<typename T>
+        __m256i doBroadcast256(T CharacterSource) noexcept {
+            if constexpr (sizeof(T) == 1) return _mm256_set1_epi8((char) CharacterSource);
+            else return _mm256_set1_epi16((short) CharacterSource);
+        }
+
+        template<typename T>
+        uint32_t doCompare256(const T *CharacterSource, __m256i CharacterTarget) noexcept {
+            __m256i CharacterVector = _mm256_loadu_si256((const __m256i*) CharacterSource);
+            if constexpr (sizeof(T) == 1) return (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(CharacterVector, CharacterTarget));
+            else return (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi16(CharacterVector, CharacterTarget)) & 0x55555555;
+        }
+#endif
+
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+        template<typename T>
+        __m128i doBroadcast128(T CharacterSource) noexcept {
+            if constexpr (sizeof(T) == 1) return _mm_set1_epi8((char) CharacterSource);
+            else return _mm_set1_epi16((short) CharacterSource);
+        }
+
+        template<typename T>
+        uint32_t doCompare128(const T *CharacterSource, __m128i CharacterTarget) noexcept {
+            __m128i CharacterVector = _mm_loadu_si128((const __m128i*) CharacterSource);
+            if constexpr (sizeof(T) == 1) return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(CharacterVector, CharacterTarget));
+            else return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi16(CharacterVector, CharacterTarget)) & 0x5555;
+        }
+#endif
+
+        template<typename Ts, typename Tt>
+        bool isMatch(const Ts *CharacterSource, const Tt *CharacterTarget, intmax_t CharacterSize) noexcept {
+            if constexpr (Type::isSame<Ts, Tt>) return !::memcmp(CharacterSource, CharacterTarget, CharacterSize * sizeof(Ts));
+            else {
+                for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
+                    if (CharacterSource[CharacterIndex] != CharacterTarget[CharacterIndex]) return false;
+                return true;
+            }
+        }
+
+        template<typename T>
+        intmax_t doSearchCharacter(const T *CharacterSource, intmax_t CharacterSize, T CharacterTarget) noexcept {
+            if constexpr (sizeof(T) == 1) {
+                auto *CharacterResult = (const T*) ::memchr(CharacterSource, CharacterTarget, CharacterSize);
+                return CharacterResult ? CharacterResult - CharacterSource : -1;
+            } else {
+                intmax_t CharacterIndex = 0;
+#if defined(__AVX2__)
+                __m256i CharacterTarget256 = doBroadcast256(CharacterTarget);
+                for (;CharacterIndex + 16 <= CharacterSize;CharacterIndex += 16)
+                    if (uint32_t CharacterMask = doCompare256(CharacterSource + CharacterIndex, CharacterTarget256))
+                        return CharacterIndex + (::std::countr_zero(CharacterMask) >> 1);
+#endif
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+                __m128i CharacterTarget128 = doBroadcast128(CharacterTarget);
+                for (;CharacterIndex + 8 <= CharacterSize;CharacterIndex += 8)
+                    if (uint32_t CharacterMask = doCompare128(CharacterSource + CharacterIndex, CharacterTarget128))
+                        return CharacterIndex + (::std::countr_zero(CharacterMask) >> 1);
+#endif
+                for (;CharacterIndex < CharacterSize;++CharacterIndex)
+                    if (CharacterSource[CharacterIndex] == CharacterTarget) return CharacterIndex;
+                return -1;
+            }
+        }
+
+        /**
+         * Boyer-Moore-Horspool search keyed on the low byte of each code unit
+         */
+        template<typename Ts, typename Tt>
+        intmax_t doSearchHorspool(const Ts *CharacterSource, intmax_t CharacterSourceSize, const Tt *CharacterTarget, intmax_t CharacterTargetSize) noexcept {
+            intmax_t CharacterShift[256];
+            for (intmax_t &CharacterShiftCurrent : CharacterShift) CharacterShiftCurrent = CharacterTargetSize;
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterTargetSize - 1;++CharacterIndex)
+                CharacterShift[CharacterTarget[CharacterIndex] & 0xFF] = CharacterTargetSize - 1 - CharacterIndex;
+            for (intmax_t CharacterIndex = 0;CharacterIndex <= CharacterSourceSize - CharacterTargetSize;CharacterIndex += CharacterShift[CharacterSource[CharacterIndex + CharacterTargetSize - 1] & 0xFF])
+                if (CharacterSource[CharacterIndex + CharacterTargetSize - 1] == CharacterTarget[CharacterTargetSize - 1] && isMatch(CharacterSource + CharacterIndex, CharacterTarget, CharacterTargetSize - 1))
+                    return CharacterIndex;
+            return -1;
+        }
+
+        /**
+         * Filters candidate positions by comparing the first and the last code unit of the target a vector at a time
+         */
+        template<typename Ts, typename Tt>
+        intmax_t doSearchString(const Ts *CharacterSource, intmax_t CharacterSourceSize, const Tt *CharacterTarget, intmax_t CharacterTargetSize) noexcept {
+            if (!CharacterTargetSize) return 0;
+            if (CharacterTargetSize > CharacterSourceSize) return -1;
+            if constexpr (sizeof(Tt) > sizeof(Ts)) {
+                for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterTargetSize;++CharacterIndex)
+                    if (CharacterTarget[CharacterIndex] > 0xFF) return -1;
+            }
+            if (CharacterTargetSize == 1) return doSearchCharacter(CharacterSource, CharacterSourceSize, (Ts) CharacterTarget[0]);
+            if (CharacterTargetSize > StringSearchThreshold) return doSearchHorspool(CharacterSource, CharacterSourceSize, CharacterTarget, CharacterTargetSize);
+            auto CharacterFirst = (Ts) CharacterTarget[0], CharacterLast = (Ts) CharacterTarget[CharacterTargetSize - 1];
+            intmax_t CharacterIndex = 0, CharacterLimit = CharacterSourceSize - CharacterTargetSize;
+#if defined(__AVX2__)
+            constexpr intmax_t CharacterLane256 = 32 / sizeof(Ts);
+            __m256i CharacterFirst256 = doBroadcast256(CharacterFirst), CharacterLast256 = doBroadcast256(CharacterLast);
+            for (;CharacterIndex + CharacterLane256 - 1 <= CharacterLimit;CharacterIndex += CharacterLane256) {
+                uint32_t CharacterMask = doCompare256(CharacterSource + CharacterIndex, CharacterFirst256) & doCompare256(CharacterSource + CharacterIndex + CharacterTargetSize - 1, CharacterLast256);
+                for (;CharacterMask;CharacterMask &= CharacterMask - 1) {
+                    intmax_t CharacterOffset = ::std::countr_zero(CharacterMask) / (intmax_t) sizeof(Ts);
+                    if (isMatch(CharacterSource + CharacterIndex + CharacterOffset + 1, CharacterTarget + 1, CharacterTargetSize - 2))
+                        return CharacterIndex + CharacterOffset;
+                }
+            }
+#endif
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+            constexpr intmax_t CharacterLane128 = 16 / sizeof(Ts);
+            __m128i CharacterFirst128 = doBroadcast128(CharacterFirst), CharacterLast128 = doBroadcast128(CharacterLast);
+            for (;CharacterIndex + CharacterLane128 - 1 <= CharacterLimit;CharacterIndex += CharacterLane128) {
+                uint32_t CharacterMask = doCompare128(CharacterSource + CharacterIndex, CharacterFirst128) & doCompare128(CharacterSource + CharacterIndex + CharacterTargetSize - 1, CharacterLast128);
+                for (;CharacterMask;CharacterMask &= CharacterMask - 1) {
+                    intmax_t CharacterOffset = ::std::countr_zero(CharacterMask) / (intmax_t) sizeof(Ts);
+                    if (isMatch(CharacterSource + CharacterIndex + CharacterOffset + 1, CharacterTarget + 1, CharacterTargetSize - 2))
+                        return CharacterIndex + CharacterOffset;
+                }
+            }
+#endif
+            for (;CharacterIndex <= CharacterLimit;++CharacterIndex)
+                if (CharacterSource[CharacterIndex] == CharacterFirst && CharacterSource[CharacterIndex + CharacterTargetSize - 1] == CharacterLast && isMatch(CharacterSource + CharacterIndex + 1, CharacterTarget + 1, CharacterTargetSize - 2))
+                    return CharacterIndex;
+            return -1;
+        }
+
+        intmax_t getAsciiPrefix(const uint8_t *CharacterSource, intmax_t CharacterSize) noexcept {
+            intmax_t CharacterIndex = 0;
+#if defined(__AVX2__)
+            for (;CharacterIndex + 32 <= CharacterSize;CharacterIndex += 32)
+                if (auto CharacterMask = (uint32_t) _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) (CharacterSource + CharacterIndex))))
+                    return CharacterIndex + ::std::countr_zero(CharacterMask);
+#endif
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+            for (;CharacterIndex + 16 <= CharacterSize;CharacterIndex += 16)
+                if (auto CharacterMask = (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex))))
+                    return CharacterIndex + ::std::countr_zero(CharacterMask);
+#endif
+            while (CharacterIndex < CharacterSize && CharacterSource[CharacterIndex] < 0x80) ++CharacterIndex;
+            return CharacterIndex;
+        }
+
+        intmax_t getAsciiPrefix(const char16_t *CharacterSource, intmax_t CharacterSize) noexcept {
+            intmax_t CharacterIndex = 0;
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+            __m128i CharacterFilter = _mm_set1_epi16((short) 0xFF80);
+            for (;CharacterIndex + 8 <= CharacterSize;CharacterIndex += 8) {
+                __m128i CharacterVector = _mm_and_si128(_mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex)), CharacterFilter);
+                auto CharacterMask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi16(CharacterVector, _mm_setzero_si128())) ^ 0xFFFF;
+                if (CharacterMask) return CharacterIndex + (::std::countr_zero(CharacterMask) >> 1);
+            }
+#endif
+            while (CharacterIndex < CharacterSize && CharacterSource[CharacterIndex] < 0x80) ++CharacterIndex;
+            return CharacterIndex;
+        }
+
+        /**
+         * Decodes one multibyte UTF-8 sequence and returns its length, or 0 if it is malformed, overlong, a surrogate or beyond U+10FFFF
+         */
+        intmax_t doDecodeSequence(const uint8_t *CharacterSource, intmax_t CharacterSize, char32_t &CharacterValue) noexcept {
+            intmax_t CharacterLength;
+            if (CharacterSource[0] >= 0xC2 && CharacterSource[0] <= 0xDF) CharacterLength = 2, CharacterValue = CharacterSource[0] & 0x1F;
+            else if (CharacterSource[0] >= 0xE0 && CharacterSource[0] <= 0xEF) CharacterLength = 3, CharacterValue = CharacterSource[0] & 0x0F;
+            else if (CharacterSource[0] >= 0xF0 && CharacterSource[0] <= 0xF4) CharacterLength = 4, CharacterValue = CharacterSource[0] & 0x07;
+            else return 0;
+            if (CharacterLength > CharacterSize) return 0;
+            for (intmax_t CharacterIndex = 1;CharacterIndex < CharacterLength;++CharacterIndex) {
+                if ((CharacterSource[CharacterIndex] & 0xC0) != 0x80) return 0;
+                CharacterValue = (CharacterValue << 6) | (CharacterSource[CharacterIndex] & 0x3F);
+            }
+            if (CharacterLength == 3 && (CharacterValue < 0x800 || CharacterUtility::isSurrogate(CharacterValue))) return 0;
+            if (CharacterLength == 4 && (CharacterValue < 0x10000 || CharacterValue > 0x10FFFF)) return 0;
+            return CharacterLength;
+        }
+
+        /**
+         * Validates UTF-8 input and measures its UTF-16 length and its largest code point
+         */
+        bool doMeasureUtf8(const uint8_t *CharacterSource, intmax_t CharacterSize, intmax_t &UnitSize, char32_t &UnitMaximum) noexcept {
+            UnitSize = 0;
+            UnitMaximum = 0;
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;) {
+                if (intmax_t CharacterAscii = getAsciiPrefix(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex)) {
+                    CharacterIndex += CharacterAscii;
+                    UnitSize += CharacterAscii;
+                    continue;
+                }
+                char32_t CharacterValue;
+                intmax_t CharacterLength = doDecodeSequence(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex, CharacterValue);
+                if (!CharacterLength) return false;
+                CharacterIndex += CharacterLength;
+                UnitSize += CharacterValue > 0xFFFF ? 2 : 1;
+                UnitMaximum = Objects::getMaximum(UnitMaximum, CharacterValue);
+            }
+            return true;
+        }
+
+        template<typename T>
+        void doDecodeUtf8(const uint8_t *CharacterSource, intmax_t CharacterSize, T *CharacterTarget) noexcept {
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;) {
+                if (intmax_t CharacterAscii = getAsciiPrefix(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex)) {
+                    if constexpr (sizeof(T) == 1) ::memcpy(CharacterTarget, CharacterSource + CharacterIndex, CharacterAscii);
+                    else {
+                        intmax_t CharacterOffset = 0;
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+                        for (;CharacterOffset + 16 <= CharacterAscii;CharacterOffset += 16) {
+                            __m128i CharacterVector = _mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex + CharacterOffset));
+                            _mm_storeu_si128((__m128i*) (CharacterTarget + CharacterOffset), _mm_unpacklo_epi8(CharacterVector, _mm_setzero_si128()));
+                            _mm_storeu_si128((__m128i*) (CharacterTarget + CharacterOffset + 8), _mm_unpackhi_epi8(CharacterVector, _mm_setzero_si128()));
+                        }
+#endif
+                        for (;CharacterOffset < CharacterAscii;++CharacterOffset)
+                            CharacterTarget[CharacterOffset] = CharacterSource[CharacterIndex + CharacterOffset];
+                    }
+                    CharacterIndex += CharacterAscii;
+                    CharacterTarget += CharacterAscii;
+                    continue;
+                }
+                char32_t CharacterValue;
+                CharacterIndex += doDecodeSequence(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex, CharacterValue);
+                if constexpr (sizeof(T) == 2) {
+                    if (CharacterValue > 0xFFFF) {
+                        CharacterValue -= 0x10000;
+                        *CharacterTarget++ = char16_t(0xD800 + (CharacterValue >> 10));
+                        *CharacterTarget++ = char16_t(0xDC00 + (CharacterValue & 0x3FF));
+                        continue;
+                    }
+                }
+                *CharacterTarget++ = (T) CharacterValue;
+            }
+        }
+
+        template<typename T>
+        intmax_t getUtf8Size(const T *CharacterSource, intmax_t CharacterSize) noexcept {
+            intmax_t CharacterResult = 0;
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex) {
+                if (intmax_t CharacterAscii = getAsciiPrefix(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex)) {
+                    CharacterResult += CharacterAscii;
+                    if ((CharacterIndex += CharacterAscii) == CharacterSize) break;
+                }
+                if (CharacterSource[CharacterIndex] < 0x800) CharacterResult += 2;
+                else if (CharacterUtility::isHighSurrogate(CharacterSource[CharacterIndex]) && CharacterIndex + 1 < CharacterSize && CharacterUtility::isLowSurrogate(CharacterSource[CharacterIndex + 1]))
+                    CharacterResult += 4, ++CharacterIndex;
+                else CharacterResult += 3;
+            }
+            return CharacterResult;
+        }
+
+        /**
+         * Encodes code units as UTF-8, replacing unpaired surrogates with U+FFFD
+         */
+        template<typename T>
+        void doEncodeUtf8(const T *CharacterSource, intmax_t CharacterSize, uint8_t *CharacterTarget) noexcept {
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex) {
+                if (intmax_t CharacterAscii = getAsciiPrefix(CharacterSource + CharacterIndex, CharacterSize - CharacterIndex)) {
+                    if constexpr (sizeof(T) == 1) ::memcpy(CharacterTarget, CharacterSource + CharacterIndex, CharacterAscii);
+                    else {
+                        intmax_t CharacterOffset = 0;
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+                        for (;CharacterOffset + 8 <= CharacterAscii;CharacterOffset += 8) {
+                            __m128i CharacterVector = _mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex + CharacterOffset));
+                            _mm_storel_epi64((__m128i*) (CharacterTarget + CharacterOffset), _mm_packus_epi16(CharacterVector, CharacterVector));
+                        }
+#endif
+                        for (;CharacterOffset < CharacterAscii;++CharacterOffset)
+                            CharacterTarget[CharacterOffset] = (uint8_t) CharacterSource[CharacterIndex + CharacterOffset];
+                    }
+                    CharacterTarget += CharacterAscii;
+                    if ((CharacterIndex += CharacterAscii) == CharacterSize) break;
+                }
+                char32_t CharacterValue = CharacterSource[CharacterIndex];
+                if (CharacterValue < 0x800) {
+                    *CharacterTarget++ = uint8_t(0xC0 | (CharacterValue >> 6));
+                    *CharacterTarget++ = uint8_t(0x80 | (CharacterValue & 0x3F));
+                    continue;
+                }
+                if (CharacterUtility::isHighSurrogate(CharacterValue) && CharacterIndex + 1 < CharacterSize && CharacterUtility::isLowSurrogate(CharacterSource[CharacterIndex + 1])) {
+                    CharacterValue = 0x10000 + ((CharacterValue - 0xD800) << 10) + (CharacterSource[++CharacterIndex] - 0xDC00);
+                    *CharacterTarget++ = uint8_t(0xF0 | (CharacterValue >> 18));
+                    *CharacterTarget++ = uint8_t(0x80 | ((CharacterValue >> 12) & 0x3F));
+                } else {
+                    if (CharacterUtility::isSurrogate(CharacterValue)) CharacterValue = 0xFFFD;
+                    *CharacterTarget++ = uint8_t(0xE0 | (CharacterValue >> 12));
+                }
+                *CharacterTarget++ = uint8_t(0x80 | ((CharacterValue >> 6) & 0x3F));
+                *CharacterTarget++ = uint8_t(0x80 | (CharacterValue & 0x3F));
+            }
+        }
+
+        /**
+         * Applies simple case mapping unit by unit, converting all-ASCII blocks with SSE2 and keeping surrogate pairs together
+         */
+        template<bool CaseUpper, typename S, typename T>
+        void doMapCase(const S *CharacterSource, intmax_t CharacterSize, T *CharacterTarget) noexcept {
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;) {
+#if defined(__SSE2__) || eLibraryArchitecture(AMD64)
+                if constexpr (sizeof(S) == 1 && sizeof(T) == 1) {
+                    for (;CharacterIndex + 16 <= CharacterSize;CharacterIndex += 16) {
+                        __m128i CharacterVector = _mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex));
+                        if (_mm_movemask_epi8(CharacterVector)) break;
+                        __m128i CharacterMask = _mm_cmplt_epi8(_mm_add_epi8(CharacterVector, _mm_set1_epi8(char(0x80 - (CaseUpper ? 'a' : 'A')))), _mm_set1_epi8(char(0x80 + 26)));
+                        _mm_storeu_si128((__m128i*) (CharacterTarget + CharacterIndex), _mm_xor_si128(CharacterVector, _mm_and_si128(CharacterMask, _mm_set1_epi8(0x20))));
+                    }
+                } else if constexpr (sizeof(S) == 2 && sizeof(T) == 2) {
+                    for (;CharacterIndex + 8 <= CharacterSize;CharacterIndex += 8) {
+                        __m128i CharacterVector = _mm_loadu_si128((const __m128i*) (CharacterSource + CharacterIndex));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(CharacterVector, _mm_set1_epi16((short) 0xFF80)), _mm_setzero_si128())) != 0xFFFF) break;
+                        __m128i CharacterMask = _mm_cmplt_epi16(_mm_add_epi16(CharacterVector, _mm_set1_epi16(short(0x8000 - (CaseUpper ? 'a' : 'A')))), _mm_set1_epi16(short(0x8000 + 26)));
+                        _mm_storeu_si128((__m128i*) (CharacterTarget + CharacterIndex), _mm_xor_si128(CharacterVector, _mm_and_si128(CharacterMask, _mm_set1_epi16(0x20))));
+                    }
+                }
+#endif
+                for (intmax_t CharacterStop = Objects::getMinimum(CharacterIndex + 16, CharacterSize);CharacterIndex < CharacterStop;++CharacterIndex) {
+                    char32_t CharacterValue = CharacterSource[CharacterIndex];
+                    if constexpr (sizeof(S) == 2) {
+                        if (CharacterUtility::isHighSurrogate(CharacterValue) && CharacterIndex + 1 < CharacterSize && CharacterUtility::isLowSurrogate(CharacterSource[CharacterIndex + 1])) {
+                            CharacterValue = 0x10000 + ((CharacterValue - 0xD800) << 10) + (CharacterSource[CharacterIndex + 1] - 0xDC00);
+                            CharacterValue = (CaseUpper ? CharacterUtility::toUpperCase(CharacterValue) : CharacterUtility::toLowerCase(CharacterValue)) - 0x10000;
+                            CharacterTarget[CharacterIndex] = T(0xD800 + (CharacterValue >> 10));
+                            CharacterTarget[++CharacterIndex] = T(0xDC00 + (CharacterValue & 0x3FF));
+                            continue;
+                        }
+                    }
+                    CharacterTarget[CharacterIndex] = (T) (CaseUpper ? CharacterUtility::toUpperCase(CharacterValue) : CharacterUtility::toLowerCase(CharacterValue));
+                }
+            }
+        }
+    }
+
+
     CharacterLatin1 Character::toLantin1() const noexcept {
         return {CharacterValue > 0xFF ? '\0' : (char) CharacterValue};
     }
@@ -50,39 +453,101 @@ namespace eLibrary::Core {
         return StringResult.toString();
     }
 
-    String::String(const eLibrary::Core::StringBuilder &StringSource) noexcept : CharacterSize((intmax_t) StringSource.CharacterSize) {
-        CharacterContainer = CharacterAllocator.doAllocate(CharacterSize + 1);
-        Collections::doCopy(StringSource.CharacterContainer, CharacterSize, CharacterContainer);
-        CharacterContainer[CharacterSize] = Character();
+    String::String(const eLibrary::Core::StringBuilder &StringSource) noexcept : CharacterResource(StringSource.CharacterAllocator.getMemoryResource()) {
+        if (!StringSource.ChunkHead) {
+            doInitialize(StringSource.CharacterContainer, (intmax_t) StringSource.CharacterSize);
+            return;
+        }
+        bool CharacterCompressible = true;
+        StringSource.doTraverse([&](const StringView &ViewSource) {
+            CharacterCompressible = CharacterCompressible && isCompressible((const char16_t*) ViewSource.ViewContainer, ViewSource.ViewSize);
+        });
+        void *CharacterTarget = doCreate((intmax_t) StringSource.getCharacterSize(), CharacterCompressible ? StringCoder::CoderLatin1 : StringCoder::CoderUtf16);
+        StringSource.doTraverse([&](const StringView &ViewSource) {
+            auto *CharacterArray = (const char16_t*) ViewSource.ViewContainer;
+            if (CharacterCompressible) {
+                for (intmax_t CharacterIndex = 0;CharacterIndex < ViewSource.ViewSize;++CharacterIndex)
+                    ((uint8_t*) CharacterTarget)[CharacterIndex] = (uint8_t) CharacterArray[CharacterIndex];
+                CharacterTarget = (uint8_t*) CharacterTarget + ViewSource.ViewSize;
+            } else {
+                Collections::doCopy(CharacterArray, ViewSource.ViewSize, (char16_t*) CharacterTarget);
+                CharacterTarget = (char16_t*) CharacterTarget + ViewSource.ViewSize;
+            }
+        });
+    }
+
+    String::String(const char16_t *StringSource, intmax_t StringSize, const MemoryAllocator<char16_t> &AllocatorSource) noexcept : CharacterResource(AllocatorSource.getMemoryResource()) {
+        doInitialize(StringSource, StringSize);
+    }
+
+    String::String(const String &StringSource, const MemoryAllocator<char16_t> &AllocatorSource) noexcept : CharacterResource(AllocatorSource.getMemoryResource()) {
+        ::memcpy(doCreate(StringSource.CharacterSize, StringSource.CharacterCoder), StringSource.getCharacterContainer(), getStorageSize(StringSource.CharacterSize, StringSource.CharacterCoder) * sizeof(char16_t));
+        CharacterHash = ::std::atomic_ref<uintmax_t>(StringSource.CharacterHash).load(::std::memory_order_relaxed);
     }
 
-    String::String(const ::std::u16string &StringSource) noexcept : CharacterSize((intmax_t) StringSource.size()) {
-        CharacterContainer = CharacterAllocator.doAllocate(CharacterSize + 1);
-        Collections::doCopy(StringSource.begin(), StringSource.end(), CharacterContainer);
-        CharacterContainer[CharacterSize] = Character();
+    String::String(const ::std::u16string &StringSource, const MemoryAllocator<char16_t> &AllocatorSource) noexcept : String(StringSource.data(), (intmax_t) StringSource.size(), AllocatorSource) {}
+
+    String::String(const StringView &StringSource, const MemoryAllocator<char16_t> &AllocatorSource) noexcept : CharacterResource(AllocatorSource.getMemoryResource()) {
+        if (StringSource.ViewCoder == StringCoder::CoderLatin1) ::memcpy(doCreate(StringSource.ViewSize, StringCoder::CoderLatin1), StringSource.ViewContainer, StringSource.ViewSize);
+        else doInitialize((const char16_t*) StringSource.ViewContainer, StringSource.ViewSize);
     }
 
     String::~String() noexcept {
-        CharacterAllocator.doDeallocate(CharacterContainer, CharacterSize + 1);
+        doDestroy();
+    }
+
+    void *String::doCreate(intmax_t CharacterSizeNew, StringCoder CharacterCoderNew) noexcept {
+        CharacterSize = CharacterSizeNew;
+        CharacterCoder = CharacterCoderNew;
+        CharacterNull = false;
+        CharacterHash = 0;
+        if (!isInline()) CharacterContainer = MemoryAllocator<char16_t>(CharacterResource).doAllocate(getStorageSize(CharacterSize, CharacterCoder));
+        void *CharacterTarget = getCharacterContainer();
+        if (CharacterCoder == StringCoder::CoderLatin1) ((uint8_t*) CharacterTarget)[CharacterSize] = 0;
+        else ((char16_t*) CharacterTarget)[CharacterSize] = char16_t();
+        return CharacterTarget;
+    }
+
+    void String::doDestroy() noexcept {
+        if (!isInline()) MemoryAllocator<char16_t>(CharacterResource).doDeallocate((char16_t*) CharacterContainer, getStorageSize(CharacterSize, CharacterCoder));
         CharacterSize = 0;
-        CharacterContainer = nullptr;
+        CharacterCoder = StringCoder::CoderLatin1;
+        CharacterNull = true;
+        CharacterHash = 0;
+        CharacterStorage[0] = char16_t();
+    }
+
+    void String::doInitialize(const char16_t *CharacterSource, intmax_t CharacterSizeSource) noexcept {
+        if (isCompressible(CharacterSource, CharacterSizeSource)) {
+            auto *CharacterTarget = (uint8_t*) doCreate(CharacterSizeSource, StringCoder::CoderLatin1);
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSizeSource;++CharacterIndex)
+                CharacterTarget[CharacterIndex] = (uint8_t) CharacterSource[CharacterIndex];
+        } else Collections::doCopy(CharacterSource, CharacterSizeSource, (char16_t*) doCreate(CharacterSizeSource, StringCoder::CoderUtf16));
     }
 
     void String::doAssign(const String &StringSource) noexcept {
         if (Objects::getAddress(StringSource) == this) return;
-        CharacterAllocator.doDeallocate(CharacterContainer, CharacterSize + 1);
-        CharacterContainer = CharacterAllocator.doAllocate((CharacterSize = StringSource.CharacterSize) + 1);
-        Collections::doCopy(StringSource.CharacterContainer, CharacterSize, CharacterContainer);
-        CharacterContainer[CharacterSize] = Character();
+        doDestroy();
+        CharacterResource = StringSource.CharacterResource;
+        ::memcpy(doCreate(StringSource.CharacterSize, StringSource.CharacterCoder), StringSource.getCharacterContainer(), getStorageSize(StringSource.CharacterSize, StringSource.CharacterCoder) * sizeof(char16_t));
+        CharacterHash = ::std::atomic_ref<uintmax_t>(StringSource.CharacterHash).load(::std::memory_order_relaxed);
     }
 
     void String::doAssign(String &&StringSource) noexcept {
         if (Objects::getAddress(StringSource) == this) return;
-        CharacterAllocator.doDeallocate(CharacterContainer, CharacterSize + 1);
-        CharacterContainer = StringSource.CharacterContainer;
+        doDestroy();
+        CharacterResource = StringSource.CharacterResource;
         CharacterSize = StringSource.CharacterSize;
-        StringSource.CharacterContainer = nullptr;
+        CharacterCoder = StringSource.CharacterCoder;
+        CharacterNull = StringSource.CharacterNull;
+        CharacterHash = StringSource.CharacterHash;
+        if (isInline()) ::memcpy(CharacterStorage, StringSource.CharacterStorage, sizeof(CharacterStorage));
+        else CharacterContainer = StringSource.CharacterContainer;
         StringSource.CharacterSize = 0;
+        StringSource.CharacterCoder = StringCoder::CoderLatin1;
+        StringSource.CharacterNull = true;
+        StringSource.CharacterHash = 0;
+        StringSource.CharacterStorage[0] = char16_t();
     }
 
     String String::doConcat(const Character &CharacterSource) const noexcept {
@@ -99,8 +564,24 @@ namespace eLibrary::Core {
         return CharacterStream.toString();
     }
 
-    Reference<String> String::doIntern() const {
-        return {StringPool::getInstance().doIntern(*this)};
+    template<bool CaseUpper>
+    String String::doConvertCase() const noexcept {
+        String StringResult(StringView(), CharacterResource);
+        if (CharacterCoder == StringCoder::CoderLatin1) {
+            auto *CharacterSource = (const uint8_t*) getCharacterContainer();
+            if (!CaseUpper || (!::memchr(CharacterSource, 0xB5, CharacterSize) && !::memchr(CharacterSource, 0xFF, CharacterSize)))
+                doMapCase<CaseUpper>(CharacterSource, CharacterSize, (uint8_t*) StringResult.doCreate(CharacterSize, StringCoder::CoderLatin1));
+            else doMapCase<CaseUpper>(CharacterSource, CharacterSize, (char16_t*) StringResult.doCreate(CharacterSize, StringCoder::CoderUtf16));
+            return StringResult;
+        }
+        auto *CharacterTarget = (char16_t*) StringResult.doCreate(CharacterSize, StringCoder::CoderUtf16);
+        doMapCase<CaseUpper>((const char16_t*) getCharacterContainer(), CharacterSize, CharacterTarget);
+        if (isCompressible(CharacterTarget, CharacterSize)) return {CharacterTarget, CharacterSize, CharacterResource};
+        return StringResult;
+    }
+
+    const String &String::doIntern() const {
+        return StringPool::getInstance().doIntern(*this);
     }
 
     String String::doRepeat(uintmax_t StringCount) const noexcept {
@@ -111,110 +592,91 @@ namespace eLibrary::Core {
         return CharacterStream.toString();
     }
 
-    String String::doReplace(const String &StringTarget, const String &StringSource) const noexcept {
-        StringBuilder CharacterStream;
-        for (intmax_t Character1 = 0, Character2;Character1 < CharacterSize;++Character1) {
-            for (Character2 = 0; Character2 < StringTarget.CharacterSize && !CharacterContainer[Character1 + Character2].doCompare(StringTarget.CharacterContainer[Character2]); ++Character2);
-            if (Character2 == StringTarget.CharacterSize) {
-                CharacterStream.addString(StringSource);
-                Character1 += StringTarget.CharacterSize - 1;
-            } else CharacterStream.addCharacter(CharacterContainer[Character1]);
-        }
+    String String::doReplace(const StringView &StringTarget, const StringView &StringSource) const noexcept {
+        StringView ViewSource(*this);
+        intmax_t CharacterFound = StringTarget.isEmpty() ? -1 : ViewSource.doFind(StringTarget);
+        if (CharacterFound == -1) return *this;
+        StringBuilder CharacterStream(CharacterSize);
+        intmax_t CharacterStart = 0;
+        do {
+            CharacterStream.addString(ViewSource.getSlice(CharacterStart, CharacterStart + CharacterFound));
+            CharacterStream.addString(StringSource);
+            CharacterStart += CharacterFound + StringTarget.getCharacterSize();
+        } while ((CharacterFound = ViewSource.getSlice(CharacterStart, CharacterSize).doFind(StringTarget)) != -1);
+        CharacterStream.addString(ViewSource.getSlice(CharacterStart, CharacterSize));
         return CharacterStream.toString();
     }
 
     String String::doReverse() const noexcept {
         StringBuilder CharacterStream(CharacterSize);
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-            CharacterStream.addCharacter(CharacterContainer[CharacterSize - CharacterIndex - 1]);
+        doDispatch([&](auto *CharacterArray) {
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
+                CharacterStream.addCharacter((char16_t) CharacterArray[CharacterSize - CharacterIndex - 1]);
+        });
         return CharacterStream.toString();
     }
 
     String String::doStrip(const Character &CharacterSource) const noexcept {
-        StringBuilder CharacterStream;
-        for (intmax_t CharacterIndex = 0; CharacterIndex < CharacterSize; ++CharacterIndex)
-            if (Objects::doCompare(CharacterContainer[CharacterIndex], CharacterSource)) CharacterStream.addCharacter(CharacterContainer[CharacterIndex]);
+        StringView ViewSource(*this);
+        intmax_t CharacterFound = ViewSource.doFind(CharacterSource);
+        if (CharacterFound == -1) return *this;
+        StringBuilder CharacterStream(CharacterSize);
+        intmax_t CharacterStart = 0;
+        do {
+            CharacterStream.addString(ViewSource.getSlice(CharacterStart, CharacterStart + CharacterFound));
+            CharacterStart += CharacterFound + 1;
+        } while ((CharacterFound = ViewSource.getSlice(CharacterStart, CharacterSize).doFind(CharacterSource)) != -1);
+        CharacterStream.addString(ViewSource.getSlice(CharacterStart, CharacterSize));
         return CharacterStream.toString();
     }
 
-    String String::doStrip(const String &StringTarget) noexcept {
-        StringBuilder CharacterStream;
-        for (intmax_t Character1 = 0, Character2;Character1 < CharacterSize;++Character1) {
-            for (Character2 = 0; Character2 < StringTarget.CharacterSize && !Objects::doCompare(CharacterContainer[Character1 + Character2], StringTarget.CharacterContainer[Character2]); ++Character2);
-            if (Character2 == StringTarget.CharacterSize) Character1 += StringTarget.CharacterSize - 1;
-            else CharacterStream.addCharacter(CharacterContainer[Character1]);
-        }
-        return CharacterStream.toString();
+    String String::doStrip(const StringView &StringTarget) const noexcept {
+        return doReplace(StringTarget, StringView());
     }
 
     String String::doTruncate(intmax_t CharacterStart, intmax_t CharacterStop) const {
-        if (CharacterStart < 0) CharacterStart += CharacterSize;
-        Collections::doCheckGE(CharacterStart, 0);
-        Collections::doCheckL(CharacterStart, CharacterSize);
-        if (CharacterStop < 0) CharacterStop += CharacterSize + 1;
-        Collections::doCheckGE(CharacterStop, 0);
-        Collections::doCheckLE(CharacterStop, CharacterSize);
-        Collections::doCheckLE(CharacterStart, CharacterStop);
-        StringBuilder CharacterStream(CharacterStop - CharacterStart);
-        for (intmax_t CharacterIndex = CharacterStart;CharacterIndex < CharacterStop;++CharacterIndex)
-            CharacterStream.addCharacter(CharacterContainer[CharacterIndex]);
-        return CharacterStream.toString();
+        return String(StringView(*this).doTruncate(CharacterStart, CharacterStop), CharacterResource);
     }
 
     Character String::getCharacter(intmax_t CharacterIndex) const {
-        if (CharacterIndex < 0) CharacterIndex += CharacterSize;
-        Collections::doCheckGE(CharacterIndex, 0);
-        Collections::doCheckL(CharacterIndex, CharacterSize);
-        return CharacterContainer[CharacterIndex];
+        return StringView(*this).getCharacter(CharacterIndex);
     }
 
     String String::toLowerCase() const noexcept {
-        StringBuilder CharacterStream(CharacterSize);
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-            CharacterStream.addCharacter(CharacterContainer[CharacterIndex].toLowerCase());
-        return CharacterStream.toString();
+        return doConvertCase<false>();
     }
 
     String String::toUpperCase() const noexcept {
-        StringBuilder CharacterStream(CharacterSize);
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-            CharacterStream.addCharacter(CharacterContainer[CharacterIndex].toUpperCase());
-        return CharacterStream.toString();
+        return doConvertCase<true>();
     }
 
     ::std::string String::toU8String() const noexcept {
-        ArrayList<char> CharacterBuffer;
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex) {
-            char32_t CharacterSource = (char16_t) CharacterContainer[CharacterIndex];
-            if (CharacterSource <= 0x7F)
-                CharacterBuffer.addElement((char) CharacterSource);
-            else if (CharacterSource <= 0x7FF) {
-                CharacterBuffer.addElement(char(0xC0 | ((CharacterSource >> 6) & 0x1F)));
-                CharacterBuffer.addElement(char(0x80 | (CharacterSource & 0x3F)));
-            } else {
-                CharacterBuffer.addElement(char(0xE0 | ((CharacterSource >> 12) & 0x0F)));
-                CharacterBuffer.addElement(char(0x80 | ((CharacterSource >> 6) & 0x3F)));
-                CharacterBuffer.addElement(char(0x80 | (CharacterSource & 0x3F)));
-            }
-        }
-        ::std::string CharacterResult(CharacterBuffer.begin(), CharacterBuffer.end());
-        return CharacterResult;
+        return doDispatch([&](auto *CharacterArray) {
+            ::std::string CharacterResult;
+            auto CharacterResultSize = (size_t) getUtf8Size(CharacterArray, CharacterSize);
+#if __cpp_lib_string_resize_and_overwrite
+            CharacterResult.resize_and_overwrite(CharacterResultSize, [&](char *CharacterTarget, size_t) {
+                doEncodeUtf8(CharacterArray, CharacterSize, (uint8_t*) CharacterTarget);
+                return CharacterResultSize;
+            });
+#else
+            CharacterResult.resize(CharacterResultSize);
+            doEncodeUtf8(CharacterArray, CharacterSize, (uint8_t*) CharacterResult.data());
+#endif
+            return CharacterResult;
+        });
     }
 
     ::std::u16string String::toU16String() const noexcept {
-        Array<char16_t> CharacterBuffer(CharacterSize);
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-            CharacterBuffer.getElement(CharacterIndex) = (char16_t) CharacterContainer[CharacterIndex];
-        ::std::u16string CharacterResult(CharacterBuffer.begin(), CharacterBuffer.end());
-        return CharacterResult;
+        return doDispatch([&](auto *CharacterArray) {
+            return ::std::u16string(CharacterArray, CharacterArray + CharacterSize);
+        });
     }
 
     ::std::u32string String::toU32String() const noexcept {
-        Array<char32_t> CharacterBuffer(CharacterSize);
-        for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-            CharacterBuffer.getElement(CharacterIndex) = (char16_t) CharacterContainer[CharacterIndex];
-        ::std::u32string CharacterResult(CharacterBuffer.begin(), CharacterBuffer.end());
-        return CharacterResult;
+        return doDispatch([&](auto *CharacterArray) {
+            return ::std::u32string(CharacterArray, CharacterArray + CharacterSize);
+        });
     }
 
     ::std::wstring String::toWString() const noexcept {
@@ -228,27 +690,20 @@ namespace eLibrary::Core {
     }
 
     String String::fromStd(const ::std::string &StringSource) {
-        StringBuilder StringResult;
-        for (intmax_t CharacterIndex = 0;CharacterIndex < StringSource.size();) {
-            char32_t CharacterValue;
-            if ((StringSource[CharacterIndex] & 0b10000000) == 0) {
-                CharacterValue = StringSource[CharacterIndex++];
-            } else if ((StringSource[CharacterIndex] & 0b11100000) == 0b11000000) {
-                CharacterValue = (StringSource[CharacterIndex++] & 0b00011111) << 6;
-                CharacterValue |= (StringSource[CharacterIndex++] & 0b00111111);
-            } else if ((StringSource[CharacterIndex] & 0b11110000) == 0b11100000) {
-                CharacterValue = (StringSource[CharacterIndex++] & 0b00001111) << 12;
-                CharacterValue |= (StringSource[CharacterIndex++] & 0b00111111) << 6;
-                CharacterValue |= (StringSource[CharacterIndex++] & 0b00111111);
-            } else doThrowChecked(Exception, u"String::valueOf(const ::std::string&) CharacterValue"_S);
-            if (CharacterValue <= 0xFFFF) StringResult.addCharacter(CharacterValue);
-            else {
-                char32_t CharacterProxy = CharacterValue - 0x10000;
-                StringResult.addCharacter(0xD800 + static_cast<char16_t>((CharacterProxy >> 10) & 0x3FF));
-                StringResult.addCharacter(0xDC00 + static_cast<char16_t>(CharacterProxy & 0x3FF));
-            }
+        auto *CharacterSource = (const uint8_t*) StringSource.data();
+        auto CharacterSourceSize = (intmax_t) StringSource.size();
+        String StringResult;
+        if (getAsciiPrefix(CharacterSource, CharacterSourceSize) == CharacterSourceSize) {
+            ::memcpy(StringResult.doCreate(CharacterSourceSize, StringCoder::CoderLatin1), CharacterSource, CharacterSourceSize);
+            return StringResult;
         }
-        return StringResult.toString();
+        intmax_t UnitSize;
+        char32_t UnitMaximum;
+        if (!doMeasureUtf8(CharacterSource, CharacterSourceSize, UnitSize, UnitMaximum))
+            doThrowChecked(Exception, u"String::fromStd(const ::std::string&) StringSource"_S);
+        if (UnitMaximum <= 0xFF) doDecodeUtf8(CharacterSource, CharacterSourceSize, (uint8_t*) StringResult.doCreate(UnitSize, StringCoder::CoderLatin1));
+        else doDecodeUtf8(CharacterSource, CharacterSourceSize, (char16_t*) StringResult.doCreate(UnitSize, StringCoder::CoderUtf16));
+        return StringResult;
     }
 
     String String::fromStd(const ::std::wstring &StringSource) noexcept {
@@ -273,39 +728,210 @@ namespace eLibrary::Core {
     }
 
     void StringBuilder::addCharacter(const Character &CharacterSource) noexcept {
-        if (CharacterSize == CharacterCapacity)
-            doReserve(CharacterCapacity ? CharacterCapacity << 1 : 1);
-        CharacterContainer[CharacterSize++] = CharacterSource;
-    }
-
-    void StringBuilder::addString(const String &StringSource) noexcept {
-        if (CharacterSize + StringSource.getCharacterSize() > CharacterCapacity)
-            doReserve(Mathematics::doCeil2(CharacterSize + StringSource.getCharacterSize()));
-        Collections::doCopy(StringSource.CharacterContainer, StringSource.getCharacterSize(), CharacterContainer + CharacterSize);
-        CharacterSize += StringSource.getCharacterSize();
+        if (!ChunkTail && CharacterSize == CharacterCapacity && CharacterCapacity < StringChunkCapacity)
+            doReserve(Objects::getMinimum(CharacterCapacity << 1, StringChunkCapacity));
+        if (!ChunkTail && CharacterSize < CharacterCapacity) {
+            CharacterContainer[CharacterSize++] = (char16_t) CharacterSource;
+            return;
+        }
+        if (!ChunkTail || ChunkTail->ChunkSize == StringChunkCapacity) addChunk();
+        ChunkTail->ChunkData[ChunkTail->ChunkSize++] = (char16_t) CharacterSource;
+        ++ChunkCharacterSize;
+    }
+
+    void StringBuilder::addChunk() noexcept {
+        auto *ChunkTarget = MemoryAllocator<StringChunk>(CharacterAllocator).acquireObject();
+        char16_t *CharacterLast = nullptr;
+        if (ChunkTail && ChunkTail->ChunkSize) CharacterLast = ChunkTail->ChunkData + ChunkTail->ChunkSize - 1;
+        else if (!ChunkTail && CharacterSize) CharacterLast = CharacterContainer + CharacterSize - 1;
+        if (CharacterLast && CharacterUtility::isHighSurrogate(*CharacterLast)) {
+            ChunkTarget->ChunkData[ChunkTarget->ChunkSize++] = *CharacterLast;
+            if (ChunkTail) --ChunkTail->ChunkSize;
+            else --CharacterSize, ++ChunkCharacterSize;
+        }
+        if (ChunkTail) ChunkTail->ChunkNext = ChunkTarget;
+        else ChunkHead = ChunkTarget;
+        ChunkTail = ChunkTarget;
+    }
+
+    void StringBuilder::addString(const StringView &StringSource) noexcept {
+        StringSource.doDispatch([&](auto *CharacterArray) {
+            auto CharacterSourceSize = (uintmax_t) StringSource.getCharacterSize();
+            uintmax_t CharacterIndex = 0;
+            if (!ChunkTail) {
+                if (CharacterSize + CharacterSourceSize > CharacterCapacity && CharacterCapacity < StringChunkCapacity)
+                    doReserve(Objects::getMinimum(Mathematics::doCeil2(CharacterSize + CharacterSourceSize), Objects::getMaximum(StringChunkCapacity, CharacterSize + CharacterSourceSize)));
+                CharacterIndex = Objects::getMinimum(CharacterSourceSize, CharacterCapacity - CharacterSize);
+                Collections::doCopy(CharacterArray, CharacterIndex, CharacterContainer + CharacterSize);
+                CharacterSize += CharacterIndex;
+            }
+            while (CharacterIndex < CharacterSourceSize) {
+                if (!ChunkTail || ChunkTail->ChunkSize == StringChunkCapacity) addChunk();
+                uintmax_t CharacterCount = Objects::getMinimum(CharacterSourceSize - CharacterIndex, StringChunkCapacity - ChunkTail->ChunkSize);
+                Collections::doCopy(CharacterArray + CharacterIndex, CharacterCount, ChunkTail->ChunkData + ChunkTail->ChunkSize);
+                ChunkTail->ChunkSize += CharacterCount;
+                ChunkCharacterSize += CharacterCount;
+                CharacterIndex += CharacterCount;
+            }
+        });
     }
 
     void StringBuilder::doClear() noexcept {
-        CharacterCapacity = 0;
+        while (ChunkHead) {
+            StringChunk *ChunkNext = ChunkHead->ChunkNext;
+            MemoryAllocator<StringChunk>(CharacterAllocator).releaseObject(ChunkHead);
+            ChunkHead = ChunkNext;
+        }
+        ChunkTail = nullptr;
+        ChunkCharacterSize = 0;
+        if (!isInline()) CharacterAllocator.doDeallocate(CharacterContainer, CharacterCapacity);
+        CharacterCapacity = StringInlineCapacity;
         CharacterSize = 0;
-        CharacterAllocator.doDeallocate(CharacterContainer, CharacterSize + 1);
-        CharacterContainer = nullptr;
+        CharacterContainer = CharacterStorage;
     }
 
     void StringBuilder::doReserve(uintmax_t CharacterCapacityNew) noexcept {
-        if (!CharacterCapacity) [[unlikely]] CharacterContainer = CharacterAllocator.doAllocate(CharacterCapacity = 1);
-        if (CharacterCapacityNew > CharacterCapacity) {
-            auto *ElementBuffer = CharacterAllocator.doAllocate(CharacterSize);
-            Collections::doMove(CharacterContainer, CharacterSize, ElementBuffer);
-            CharacterAllocator.doDeallocate(CharacterContainer, CharacterCapacity);
-            CharacterContainer = CharacterAllocator.doAllocate(CharacterCapacity = CharacterCapacityNew);
-            Collections::doMove(ElementBuffer, CharacterSize, CharacterContainer);
-            CharacterAllocator.doDeallocate(ElementBuffer, CharacterSize);
+        if (ChunkTail || CharacterCapacityNew <= CharacterCapacity) return;
+        if (isInline()) {
+            char16_t *CharacterTarget = CharacterAllocator.doAllocate(CharacterCapacityNew);
+            Collections::doCopy(CharacterStorage, CharacterSize, CharacterTarget);
+            CharacterContainer = CharacterTarget;
+        } else CharacterContainer = CharacterAllocator.doReallocate(CharacterContainer, CharacterCapacity, CharacterCapacityNew);
+        CharacterCapacity = CharacterCapacityNew;
+    }
+
+    void StringView::doEncodeU8(uint8_t *CharacterTarget) const noexcept {
+        doDispatch([&](auto *CharacterSource) {
+            doEncodeUtf8(CharacterSource, ViewSize, CharacterTarget);
+        });
+    }
+
+    intmax_t StringView::doFind(const Character &CharacterSource) const noexcept {
+        auto CharacterValue = (char16_t) CharacterSource;
+        if (ViewCoder == StringCoder::CoderLatin1) {
+            if (CharacterValue > 0xFF) return -1;
+            return doSearchCharacter((const uint8_t*) ViewContainer, ViewSize, (uint8_t) CharacterValue);
         }
+        return doSearchCharacter((const char16_t*) ViewContainer, ViewSize, CharacterValue);
+    }
+
+    intmax_t StringView::doFind(const StringView &ViewTarget) const noexcept {
+        return doDispatch([&](auto *CharacterSource) {
+            return ViewTarget.doDispatch([&](auto *CharacterTarget) {
+                return doSearchString(CharacterSource, ViewSize, CharacterTarget, ViewTarget.ViewSize);
+            });
+        });
+    }
+
+    StringView StringView::doTrim() const noexcept {
+        return doDispatch([&](auto *CharacterArray) {
+            intmax_t CharacterStart = 0, CharacterStop = ViewSize;
+            while (CharacterStart < CharacterStop && CharacterUtility::isSpace(CharacterArray[CharacterStart])) ++CharacterStart;
+            while (CharacterStop > CharacterStart && CharacterUtility::isSpace(CharacterArray[CharacterStop - 1])) --CharacterStop;
+            return getSlice(CharacterStart, CharacterStop);
+        });
+    }
+
+    StringView StringView::doTrim(const Character &CharacterSource) const noexcept {
+        return doDispatch([&](auto *CharacterArray) {
+            intmax_t CharacterStart = 0, CharacterStop = ViewSize;
+            while (CharacterStart < CharacterStop && CharacterArray[CharacterStart] == (char16_t) CharacterSource) ++CharacterStart;
+            while (CharacterStop > CharacterStart && CharacterArray[CharacterStop - 1] == (char16_t) CharacterSource) --CharacterStop;
+            return getSlice(CharacterStart, CharacterStop);
+        });
+    }
+
+    StringView StringView::doTruncate(intmax_t CharacterStart, intmax_t CharacterStop) const {
+        if (CharacterStart < 0) CharacterStart += ViewSize;
+        Collections::doCheckGE(CharacterStart, 0);
+        Collections::doCheckL(CharacterStart, ViewSize);
+        if (CharacterStop < 0) CharacterStop += ViewSize + 1;
+        Collections::doCheckGE(CharacterStop, 0);
+        Collections::doCheckLE(CharacterStop, ViewSize);
+        Collections::doCheckLE(CharacterStart, CharacterStop);
+        return getSlice(CharacterStart, CharacterStop);
+    }
+
+    Character StringView::getCharacter(intmax_t CharacterIndex) const {
+        if (CharacterIndex < 0) CharacterIndex += ViewSize;
+        Collections::doCheckGE(CharacterIndex, 0);
+        Collections::doCheckL(CharacterIndex, ViewSize);
+        return doDispatch([&](auto *CharacterArray) {
+            return Character((char16_t) CharacterArray[CharacterIndex]);
+        });
+    }
+
+    uintmax_t StringView::getU8Size() const noexcept {
+        return doDispatch([&](auto *CharacterSource) {
+            return (uintmax_t) getUtf8Size(CharacterSource, ViewSize);
+        });
+    }
+
+    uintmax_t StringView::hashCode() const noexcept {
+        return doDispatch([&](auto *CharacterSource) {
+            return (uintmax_t) doHash(CharacterSource, ViewSize);
+        });
     }
 
-    Reference<String> StringPool::doIntern(const String&) {
-        throw NotImplementedException(u"StringPool::doIntern()"_S);
+    String StringView::toString() const noexcept {
+        return {*this, MemoryAllocator<char16_t>()};
+    }
+
+    StringPool::~StringPool() noexcept {
+        for (PoolShard &ShardCurrent : PoolShardList)
+            if (ShardCurrent.ShardTable) MemoryAllocator<PoolShard::ShardEntry>().doDeallocate(ShardCurrent.ShardTable, ShardCurrent.ShardCapacity);
+    }
+
+    const String &StringPool::doIntern(const StringView &StringSource) {
+        uintmax_t StringHash = StringSource.hashCode();
+        PoolShard &ShardTarget = PoolShardList[StringHash >> (64 - ::std::countr_zero(PoolShardCount))];
+        {
+            ::std::shared_lock<::std::shared_mutex> ShardLock(ShardTarget.ShardMutex);
+            if (const String *StringTarget = doSearch(ShardTarget, StringSource, StringHash)) [[likely]] return *StringTarget;
+        }
+        ::std::unique_lock<::std::shared_mutex> ShardLock(ShardTarget.ShardMutex);
+        if (const String *StringTarget = doSearch(ShardTarget, StringSource, StringHash)) return *StringTarget;
+        if ((ShardTarget.ShardSize + 1) * 2 > ShardTarget.ShardCapacity) {
+            uintmax_t ShardCapacityNew = ShardTarget.ShardCapacity ? ShardTarget.ShardCapacity * 2 : 16;
+            auto *ShardTableNew = MemoryAllocator<PoolShard::ShardEntry>().doAllocate(ShardCapacityNew);
+            ::memset((void*) ShardTableNew, 0, ShardCapacityNew * sizeof(PoolShard::ShardEntry));
+            for (uintmax_t EntryIndex = 0;EntryIndex < ShardTarget.ShardCapacity;++EntryIndex) {
+                if (!ShardTarget.ShardTable[EntryIndex].EntryString) continue;
+                uintmax_t EntryTarget = ShardTarget.ShardTable[EntryIndex].EntryHash & (ShardCapacityNew - 1);
+                while (ShardTableNew[EntryTarget].EntryString) EntryTarget = (EntryTarget + 1) & (ShardCapacityNew - 1);
+                ShardTableNew[EntryTarget] = ShardTarget.ShardTable[EntryIndex];
+            }
+            if (ShardTarget.ShardTable) MemoryAllocator<PoolShard::ShardEntry>().doDeallocate(ShardTarget.ShardTable, ShardTarget.ShardCapacity);
+            ShardTarget.ShardTable = ShardTableNew;
+            ShardTarget.ShardCapacity = ShardCapacityNew;
+        }
+        auto *StringTarget = (String*) ShardTarget.ShardResource.doAcquire(sizeof(String), alignof(String));
+        ::new ((void*) StringTarget) String(StringSource, MemoryAllocator<char16_t>(&ShardTarget.ShardResource));
+        // The arena is only safe under the shard lock, so copies and derived strings allocate from the heap instead; canonical strings are never destroyed, so nothing is released to the wrong resource
+        StringTarget->CharacterResource = HeapMemoryResource::getInstance();
+        StringTarget->CharacterHash = StringHash;
+        uintmax_t EntryTarget = StringHash & (ShardTarget.ShardCapacity - 1);
+        while (ShardTarget.ShardTable[EntryTarget].EntryString) EntryTarget = (EntryTarget + 1) & (ShardTarget.ShardCapacity - 1);
+        ShardTarget.ShardTable[EntryTarget] = {StringHash, StringTarget};
+        ++ShardTarget.ShardSize;
+        return *StringTarget;
+    }
+
+    const String *StringPool::doSearch(const PoolShard &ShardSource, const StringView &StringSource, uintmax_t StringHash) noexcept {
+        if (!ShardSource.ShardCapacity) return nullptr;
+        for (uintmax_t EntryIndex = StringHash & (ShardSource.ShardCapacity - 1);ShardSource.ShardTable[EntryIndex].EntryString;EntryIndex = (EntryIndex + 1) & (ShardSource.ShardCapacity - 1))
+            if (ShardSource.ShardTable[EntryIndex].EntryHash == StringHash && !StringView(*ShardSource.ShardTable[EntryIndex].EntryString).doCompare(StringSource))
+                return ShardSource.ShardTable[EntryIndex].EntryString;
+        return nullptr;
+    }
+
+    uintmax_t StringPool::getStringSize() const noexcept {
+        uintmax_t StringSize = 0;
+        for (const PoolShard &ShardCurrent : PoolShardList) {
+            ::std::shared_lock<::std::shared_mutex> ShardLock(ShardCurrent.ShardMutex);
+            StringSize += ShardCurrent.ShardSize;
+        }
+        return StringSize;
     }
 
     eLibraryAPI Character Literal::operator"" _C(char16_t CharacterSource) noexcept {
@@ -317,6 +943,6 @@ namespace eLibrary::Core {
     }
 
     eLibraryAPI String Literal::operator"" _S(const char16_t *StringSource, size_t StringSize) {
-        return {::std::u16string(StringSource, StringSize)};
+        return {StringSource, (intmax_t) StringSize};
     }
 }
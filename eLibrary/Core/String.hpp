@@ -5,6 +5,8 @@
 
 #include <Core/Memory.hpp>
 #include <Core/StringUnicode.hpp>
+#include <atomic>
+#include <shared_mutex>
 #include <string>
 
 namespace eLibrary::Core {
@@ -13,6 +15,7 @@ namespace eLibrary::Core {
     template<typename>
     class Reference;
     class StringBuilder;
+    class StringView;
 
     class CharacterUtility final : public NonConstructable {
     public:
@@ -84,16 +87,20 @@ namespace eLibrary::Core {
         }
 
         static char32_t toLowerCase(char32_t CharacterValue) noexcept {
-            return CharacterCaseMappingSimple::isContains(CharacterValue) ? CharacterCaseMappingSimple::doQuery(CharacterValue)[1] : CharacterValue;
+            return CharacterValue + CharacterCaseMappingSimple::doQuery(CharacterValue).MappingLower;
+        }
+
+        static char32_t toTitleCase(char32_t CharacterValue) noexcept {
+            return CharacterValue + CharacterCaseMappingSimple::doQuery(CharacterValue).MappingTitle;
         }
 
         static char32_t toUpperCase(char32_t CharacterValue) noexcept {
-            return CharacterCaseMappingSimple::isContains(CharacterValue) ? CharacterCaseMappingSimple::doQuery(CharacterValue)[0] : CharacterValue;
+            return CharacterValue + CharacterCaseMappingSimple::doQuery(CharacterValue).MappingUpper;
         }
     };
 
     /**
-     * Support for character storage and operation
+     * Support for viewing a UTF-16 code unit as a character
      */
     class Character final : public Object {
     private:
@@ -110,7 +117,7 @@ namespace eLibrary::Core {
         }
 
         bool isAlpha() const noexcept {
-            return CharacterDerivedCore::doQuery(CharacterValue) & CharacterDerivedCore::DerivedProperty_Alphabetic;
+            return CharacterUtility::isAlpha(CharacterValue);
         }
 
         bool isDigit() const noexcept {
@@ -176,6 +183,9 @@ namespace eLibrary::Core {
         eLibraryAPI static Character valueOf(uint8_t, uint8_t);
     };
 
+    template<>
+    constexpr bool Type::isTriviallyRelocatable<Character> = true;
+
     class CharacterLatin1 final : public Object {
     private:
         char CharacterValue;
@@ -222,25 +232,199 @@ namespace eLibrary::Core {
         eLibraryAPI String toString() const noexcept override;
     };
 
+    /**
+     * Support for non-owning access to the code units of a string
+     */
+    class StringView final {
+    private:
+        enum class StringCoder : uint8_t {
+            CoderLatin1, CoderUtf16
+        };
+
+        const void *ViewContainer = nullptr;
+        intmax_t ViewSize = 0;
+        StringCoder ViewCoder = StringCoder::CoderLatin1;
+
+        constexpr StringView(const void *ViewContainerSource, intmax_t ViewSizeSource, StringCoder ViewCoderSource) noexcept : ViewContainer(ViewContainerSource), ViewSize(ViewSizeSource), ViewCoder(ViewCoderSource) {}
+
+        template<typename F>
+        auto doDispatch(F &&DispatchFunction) const {
+            if (ViewCoder == StringCoder::CoderLatin1) return DispatchFunction((const uint8_t*) ViewContainer);
+            return DispatchFunction((const char16_t*) ViewContainer);
+        }
+
+        StringView getSlice(intmax_t ViewStart, intmax_t ViewStop) const noexcept {
+            if (ViewCoder == StringCoder::CoderLatin1) return {(const uint8_t*) ViewContainer + ViewStart, ViewStop - ViewStart, ViewCoder};
+            return {(const char16_t*) ViewContainer + ViewStart, ViewStop - ViewStart, ViewCoder};
+        }
+
+        friend class String;
+        friend class StringBuilder;
+    public:
+        constexpr StringView() noexcept = default;
+
+        constexpr StringView(const char16_t *ViewSource) noexcept : StringView(ViewSource, (intmax_t) ::std::char_traits<char16_t>::length(ViewSource)) {}
+
+        constexpr StringView(const char16_t *ViewSource, intmax_t ViewSizeSource) noexcept : ViewContainer(ViewSource), ViewSize(ViewSizeSource), ViewCoder(StringCoder::CoderUtf16) {}
+
+        StringView(const String&) noexcept;
+
+        intmax_t doCompare(const StringView &ViewOther) const noexcept {
+            if (ViewSize != ViewOther.ViewSize) return ViewSize - ViewOther.ViewSize;
+            if (ViewCoder == ViewOther.ViewCoder && !::memcmp(ViewContainer, ViewOther.ViewContainer, ViewCoder == StringCoder::CoderLatin1 ? ViewSize : ViewSize * 2))
+                return 0;
+            return doDispatch([&](auto *CharacterSource) {
+                return ViewOther.doDispatch([&](auto *CharacterTarget) {
+                    for (intmax_t CharacterIndex = 0; CharacterIndex < ViewSize; ++CharacterIndex)
+                        if (CharacterSource[CharacterIndex] != CharacterTarget[CharacterIndex])
+                            return (intmax_t) CharacterSource[CharacterIndex] - CharacterTarget[CharacterIndex];
+                    return (intmax_t) 0;
+                });
+            });
+        }
+
+        /**
+         * Writes the contents as UTF-8 into a buffer of at least getU8Size() bytes
+         */
+        eLibraryAPI void doEncodeU8(uint8_t*) const noexcept;
+
+        eLibraryAPI intmax_t doFind(const Character&) const noexcept;
+
+        eLibraryAPI intmax_t doFind(const StringView&) const noexcept;
+
+        StringView doStripPrefix(const StringView &ViewPrefix) const noexcept {
+            return isStartswith(ViewPrefix) ? getSlice(ViewPrefix.ViewSize, ViewSize) : *this;
+        }
+
+        StringView doStripSuffix(const StringView &ViewSuffix) const noexcept {
+            return isEndswith(ViewSuffix) ? getSlice(0, ViewSize - ViewSuffix.ViewSize) : *this;
+        }
+
+        /**
+         * Trims leading and trailing spaces
+         */
+        eLibraryAPI StringView doTrim() const noexcept;
+
+        /**
+         * Trims leading and trailing occurrences of the character, unlike String::doStrip which removes every occurrence
+         */
+        eLibraryAPI StringView doTrim(const Character&) const noexcept;
+
+        eLibraryAPI StringView doTruncate(intmax_t, intmax_t) const;
+
+        eLibraryAPI Character getCharacter(intmax_t) const;
+
+        intmax_t getCharacterSize() const noexcept {
+            return ViewSize;
+        }
+
+        eLibraryAPI uintmax_t getU8Size() const noexcept;
+
+        eLibraryAPI uintmax_t hashCode() const noexcept;
+
+        bool isContains(const StringView &ViewTarget) const noexcept {
+            return doFind(ViewTarget) != -1;
+        }
+
+        bool isEmpty() const noexcept {
+            return ViewSize == 0;
+        }
+
+        bool isEndswith(const StringView &ViewSuffix) const noexcept {
+            if (ViewSuffix.ViewSize > ViewSize) return false;
+            return getSlice(ViewSize - ViewSuffix.ViewSize, ViewSize).isStartswith(ViewSuffix);
+        }
+
+        bool isStartswith(const StringView &ViewPrefix) const noexcept {
+            if (ViewPrefix.ViewSize > ViewSize) return false;
+            return doDispatch([&](auto *CharacterSource) {
+                return ViewPrefix.doDispatch([&](auto *CharacterTarget) {
+                    for (intmax_t CharacterIndex = 0; CharacterIndex < ViewPrefix.ViewSize; ++CharacterIndex)
+                        if (CharacterSource[CharacterIndex] != CharacterTarget[CharacterIndex]) return false;
+                    return true;
+                });
+            });
+        }
+
+        eLibraryAPI String toString() const noexcept;
+    };
+
     /**
      * Support for string storage and operation
      */
     class String final : public Object {
     private:
+        using StringCoder = StringView::StringCoder;
+
+        static constexpr intmax_t StringInlineCapacity = 22;
+
         intmax_t CharacterSize = 0;
-        Character *CharacterContainer = nullptr;
-        mutable MemoryAllocator<Character> CharacterAllocator;
+        union {
+            void *CharacterContainer;
+            char16_t CharacterStorage[StringInlineCapacity + 1] = {};
+        };
+        StringCoder CharacterCoder = StringCoder::CoderLatin1;
+        // Only default-constructed and moved-from strings are null, an empty string built from any source is not
+        bool CharacterNull = true;
+        mutable uintmax_t CharacterHash = 0;
+        MemoryResource *CharacterResource = HeapMemoryResource::getInstance();
 
         eLibraryAPI String(const StringBuilder&) noexcept;
 
+        template<bool CaseUpper>
+        String doConvertCase() const noexcept;
+
+        eLibraryAPI void *doCreate(intmax_t, StringCoder) noexcept;
+
+        eLibraryAPI void doDestroy() noexcept;
+
+        template<typename F>
+        auto doDispatch(F &&DispatchFunction) const {
+            if (CharacterCoder == StringCoder::CoderLatin1) return DispatchFunction((const uint8_t*) getCharacterContainer());
+            return DispatchFunction((const char16_t*) getCharacterContainer());
+        }
+
+        eLibraryAPI void doInitialize(const char16_t*, intmax_t) noexcept;
+
+        void *getCharacterContainer() noexcept {
+            return isInline() ? CharacterStorage : CharacterContainer;
+        }
+
+        const void *getCharacterContainer() const noexcept {
+            return isInline() ? CharacterStorage : CharacterContainer;
+        }
+
+        static intmax_t getStorageSize(intmax_t CharacterSizeSource, StringCoder CharacterCoderSource) noexcept {
+            return CharacterCoderSource == StringCoder::CoderLatin1 ? CharacterSizeSource / 2 + 1 : CharacterSizeSource + 1;
+        }
+
+        static bool isCompressible(const char16_t *CharacterSource, intmax_t CharacterSizeSource) noexcept {
+            char16_t CharacterMask = 0;
+            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSizeSource;++CharacterIndex)
+                CharacterMask |= CharacterSource[CharacterIndex];
+            return CharacterMask <= 0xFF;
+        }
+
+        bool isInline() const noexcept {
+            return CharacterSize <= StringInlineCapacity;
+        }
+
         friend class StringBuilder;
+        friend class StringPool;
+        friend class StringView;
     public:
         doEnableCopyAssignConstruct(String)
         doEnableMoveAssignConstruct(String)
 
         constexpr String() noexcept = default;
 
-        eLibraryAPI String(const ::std::u16string&) noexcept;
+        eLibraryAPI String(const char16_t*, intmax_t, const MemoryAllocator<char16_t>& = {}) noexcept;
+
+        eLibraryAPI String(const String&, const MemoryAllocator<char16_t>&) noexcept;
+
+        eLibraryAPI String(const ::std::u16string&, const MemoryAllocator<char16_t>& = {}) noexcept;
+
+        eLibraryAPI String(const StringView&, const MemoryAllocator<char16_t>&) noexcept;
 
         eLibraryAPI ~String() noexcept;
 
@@ -248,12 +432,8 @@ namespace eLibrary::Core {
 
         eLibraryAPI void doAssign(String&&) noexcept;
 
-        intmax_t doCompare(const String &StringOther) const noexcept {
-            if (CharacterSize != StringOther.CharacterSize) return CharacterSize - StringOther.CharacterSize;
-            for (intmax_t CharacterIndex = 0; CharacterIndex < CharacterSize; ++CharacterIndex)
-                if (CharacterContainer[CharacterIndex].doCompare(StringOther.CharacterContainer[CharacterIndex]))
-                    return CharacterContainer[CharacterIndex].doCompare(StringOther.CharacterContainer[CharacterIndex]);
-            return 0;
+        intmax_t doCompare(const StringView &StringOther) const noexcept {
+            return StringView(*this).doCompare(StringOther);
         }
 
         eLibraryAPI String doConcat(const Character &CharacterSource) const noexcept;
@@ -261,31 +441,24 @@ namespace eLibrary::Core {
         eLibraryAPI String doConcat(const String &StringOther) const noexcept;
 
         intmax_t doFind(const Character &CharacterSource) const noexcept {
-            for (intmax_t CharacterIndex = 0;CharacterIndex < CharacterSize;++CharacterIndex)
-                if (!Objects::doCompare(CharacterContainer[CharacterIndex], CharacterSource)) return CharacterIndex;
-            return -1;
+            return StringView(*this).doFind(CharacterSource);
         }
 
-        intmax_t doFind(const String &StringTarget) const noexcept {
-            intmax_t Character1, Character2;
-            for (Character1 = 0, Character2 = 0;Character1 < CharacterSize && Character2 < StringTarget.CharacterSize; ++Character1)
-                if (!Objects::doCompare(CharacterContainer[Character1], StringTarget.CharacterContainer[Character2])) ++Character2;
-                else Character1 -= Character2, Character2 = 0;
-            if (Character2 == StringTarget.CharacterSize) return Character1 - StringTarget.CharacterSize;
-            return -1;
+        intmax_t doFind(const StringView &StringTarget) const noexcept {
+            return StringView(*this).doFind(StringTarget);
         }
 
-        eLibraryAPI [[deprecated("Not implemented")]] Reference<String> doIntern() const;
+        eLibraryAPI const String &doIntern() const;
 
         eLibraryAPI String doRepeat(uintmax_t StringCount) const noexcept;
 
-        eLibraryAPI String doReplace(const String &StringTarget, const String &StringSource) const noexcept;
+        eLibraryAPI String doReplace(const StringView &StringTarget, const StringView &StringSource) const noexcept;
 
         eLibraryAPI String doReverse() const noexcept;
 
         eLibraryAPI String doStrip(const Character &CharacterSource) const noexcept;
 
-        eLibraryAPI String doStrip(const String &StringTarget) noexcept;
+        eLibraryAPI String doStrip(const StringView &StringTarget) const noexcept;
 
         eLibraryAPI String doTruncate(intmax_t CharacterStart, intmax_t CharacterStop) const;
 
@@ -295,18 +468,26 @@ namespace eLibrary::Core {
             return CharacterSize;
         }
 
+        MemoryResource *getMemoryResource() const noexcept {
+            return CharacterResource;
+        }
+
+        /**
+         * Computes the hash once and caches it, since the contents never change after construction
+         */
         uintmax_t hashCode() const noexcept override {
-            uintmax_t CharacterCode = 0;
-            for (intmax_t ElementIndex = 0; ElementIndex < CharacterSize; ++ElementIndex)
-                CharacterCode = CharacterCode * 29 + CharacterContainer[ElementIndex].hashCode();
-            return CharacterCode;
+            // Racing threads compute the same value, so relaxed ordering is enough for the cache
+            ::std::atomic_ref<uintmax_t> HashReference(CharacterHash);
+            uintmax_t HashValue = HashReference.load(::std::memory_order_relaxed);
+            if (!HashValue) [[unlikely]] HashReference.store(HashValue = StringView(*this).hashCode(), ::std::memory_order_relaxed);
+            return HashValue;
         }
 
         bool isContains(char16_t CharacterTarget) const noexcept {
             return doFind(CharacterTarget) != -1;
         }
 
-        bool isContains(const String &StringTarget) const noexcept {
+        bool isContains(const StringView &StringTarget) const noexcept {
             return doFind(StringTarget) != -1;
         }
 
@@ -314,23 +495,20 @@ namespace eLibrary::Core {
             return CharacterSize == 0;
         }
 
-        bool isEndswith(const String &StringSuffix) const noexcept {
-            if (StringSuffix.CharacterSize > CharacterSize) return false;
-            for (intmax_t CharacterIndex = 0; CharacterIndex < StringSuffix.CharacterSize; ++CharacterIndex)
-                if (Objects::doCompare(CharacterContainer[CharacterIndex + CharacterSize - StringSuffix.CharacterSize], StringSuffix.CharacterContainer[CharacterIndex]))
-                    return false;
-            return true;
+        bool isEndswith(const StringView &StringSuffix) const noexcept {
+            return StringView(*this).isEndswith(StringSuffix);
+        }
+
+        bool isLatin1() const noexcept {
+            return CharacterCoder == StringCoder::CoderLatin1;
         }
 
         bool isNull() const noexcept {
-            return CharacterContainer == nullptr;
+            return CharacterNull;
         }
 
-        bool isStartswith(const String &StringPrefix) const noexcept {
-            if (StringPrefix.CharacterSize > CharacterSize) return false;
-            for (intmax_t CharacterIndex = 0; CharacterIndex < StringPrefix.CharacterSize; ++CharacterIndex)
-                if (Objects::doCompare(CharacterContainer[CharacterIndex], StringPrefix.CharacterContainer[CharacterIndex])) return false;
-            return true;
+        bool isStartswith(const StringView &StringPrefix) const noexcept {
+            return StringView(*this).isStartswith(StringPrefix);
         }
 
         eLibraryAPI String toLowerCase() const noexcept;
@@ -365,7 +543,7 @@ namespace eLibrary::Core {
         }
 
         template<typename T> requires Type::isConvertible<T, ::std::string>
-        static String valueOf(const T &StringSource) noexcept {
+        static String valueOf(const T &StringSource) {
             return fromStd(StringSource);
         }
 
@@ -395,18 +573,44 @@ namespace eLibrary::Core {
         static eLibraryAPI String fromStd(const ::std::wstring&) noexcept;
     };
 
+    inline StringView::StringView(const String &StringSource) noexcept : ViewContainer(StringSource.getCharacterContainer()), ViewSize(StringSource.CharacterSize), ViewCoder(StringSource.CharacterCoder) {}
+
+    /**
+     * Support for building strings, spilling into linked fixed-size chunks once the buffer grows large so that it is flattened exactly once
+     */
     class StringBuilder final : public Object, public NonCopyable {
     private:
-        uintmax_t CharacterCapacity = 0;
+        static constexpr uintmax_t StringChunkCapacity = 4096;
+        static constexpr uintmax_t StringInlineCapacity = String::StringInlineCapacity;
+
+        struct StringChunk final {
+            StringChunk *ChunkNext = nullptr;
+            uintmax_t ChunkSize = 0;
+            char16_t ChunkData[StringChunkCapacity];
+        } *ChunkHead = nullptr, *ChunkTail = nullptr;
+        uintmax_t ChunkCharacterSize = 0;
+        uintmax_t CharacterCapacity = StringInlineCapacity;
         uintmax_t CharacterSize = 0;
-        Character *CharacterContainer = nullptr;
-        mutable MemoryAllocator<Character> CharacterAllocator;
+        char16_t *CharacterContainer = CharacterStorage;
+        char16_t CharacterStorage[StringInlineCapacity];
+        mutable MemoryAllocator<char16_t> CharacterAllocator;
+
+        /**
+         * Appends an empty chunk, carrying a trailing high surrogate over so that no chunk splits a surrogate pair
+         */
+        eLibraryAPI void addChunk() noexcept;
+
+        bool isInline() const noexcept {
+            return CharacterContainer == CharacterStorage;
+        }
 
         friend class String;
     public:
         StringBuilder() noexcept = default;
 
-        explicit StringBuilder(uintmax_t CharacterCapacitySource) noexcept {
+        explicit StringBuilder(const MemoryAllocator<char16_t> &AllocatorSource) noexcept : CharacterAllocator(AllocatorSource) {}
+
+        explicit StringBuilder(uintmax_t CharacterCapacitySource, const MemoryAllocator<char16_t> &AllocatorSource = {}) noexcept : CharacterAllocator(AllocatorSource) {
             doReserve(CharacterCapacitySource);
         }
 
@@ -416,30 +620,73 @@ namespace eLibrary::Core {
 
         eLibraryAPI void addCharacter(const Character&) noexcept;
 
-        eLibraryAPI void addString(const String&) noexcept;
+        eLibraryAPI void addString(const StringView&) noexcept;
 
         eLibraryAPI void doClear() noexcept;
 
+        /**
+         * Reserves contiguous capacity, which only takes effect before the builder has spilled into chunks
+         */
         eLibraryAPI void doReserve(uintmax_t) noexcept;
 
+        /**
+         * Visits the contents in order as views, none of which splits a surrogate pair
+         */
+        template<typename F>
+        void doTraverse(F &&TraverseFunction) const {
+            if (CharacterSize) TraverseFunction(StringView(CharacterContainer, (intmax_t) CharacterSize));
+            for (StringChunk *ChunkCurrent = ChunkHead;ChunkCurrent;ChunkCurrent = ChunkCurrent->ChunkNext)
+                TraverseFunction(StringView(ChunkCurrent->ChunkData, (intmax_t) ChunkCurrent->ChunkSize));
+        }
+
+        uintmax_t getCharacterSize() const noexcept {
+            return CharacterSize + ChunkCharacterSize;
+        }
+
+        MemoryResource *getMemoryResource() const noexcept {
+            return CharacterAllocator.getMemoryResource();
+        }
+
         eLibraryAPI String toString() const noexcept override {
             return {*this};
         }
     };
 
-    class [[deprecated("Not implemented")]] StringPool final : public Object, public NonCopyable, public NonMovable {
+    /**
+     * Support for interning strings into canonical instances which compare by address
+     */
+    class StringPool final : public Object, public NonCopyable, public NonMovable {
     private:
-        struct PoolPage {
-            uint8_t *PageData = nullptr;
-            uintmax_t PageSize = 0;
-        } *PoolPageList = nullptr;
+        static constexpr uintmax_t PoolShardCount = 64;
+
+        struct alignas(64) PoolShard final {
+            struct ShardEntry final {
+                uintmax_t EntryHash;
+                const String *EntryString;
+            } *ShardTable = nullptr;
+            uintmax_t ShardCapacity = 0;
+            uintmax_t ShardSize = 0;
+            MonotonicMemoryResource ShardResource;
+            mutable ::std::shared_mutex ShardMutex;
+        } PoolShardList[PoolShardCount];
+
+        StringPool() noexcept = default;
+
+        eLibraryAPI ~StringPool() noexcept;
+
+        static const String *doSearch(const PoolShard&, const StringView&, uintmax_t) noexcept;
     public:
-        eLibraryAPI Reference<String> doIntern(const String&);
+        /**
+         * Returns the canonical instance equal to the string, adding a copy of it to the pool on first use
+         */
+        eLibraryAPI const String &doIntern(const StringView&);
 
         static StringPool &getInstance() noexcept {
             static StringPool PoolInstance;
             return PoolInstance;
         }
+
+        eLibraryAPI uintmax_t getStringSize() const noexcept;
     };
 
     inline namespace Literal {
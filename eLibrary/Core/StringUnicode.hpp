@@ -341,7 +341,16 @@ namespace eLibrary::Core {
     }
 
     namespace CharacterCaseMappingSimple {
-        eLibraryAPI const char32_t *doQuery(char32_t) noexcept;
+        /**
+         * Offsets from a code point to its simple lowercase, titlecase and uppercase mappings
+         */
+        struct CharacterCaseMapping final {
+            int32_t MappingLower;
+            int32_t MappingTitle;
+            int32_t MappingUpper;
+        };
+
+        eLibraryAPI const CharacterCaseMapping &doQuery(char32_t) noexcept;
 
         eLibraryAPI bool isContains(char32_t) noexcept;
     }
@@ -431,6 +440,8 @@ namespace eLibrary::Core {
             LVT,
             ZWJ,
         };
+
+        eLibraryAPI CharacterGraphemeBreak doQuery(char32_t) noexcept;
     }
 
     namespace CharacterLineBreak {
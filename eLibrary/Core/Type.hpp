@@ -65,6 +65,12 @@ namespace eLibrary::Core::Type {
     template<typename T>
     constexpr bool isSame<T, T> = true;
 
+    template<typename T>
+    constexpr bool isTriviallyCopyable = ::std::is_trivially_copyable_v<T>;
+
+    template<typename T>
+    constexpr bool isTriviallyRelocatable = isTriviallyCopyable<T>;
+
     template<typename>
     constexpr bool isVoid = false;
 
@@ -77,7 +77,7 @@ namespace eLibrary::IO {
         }
 
         static ByteBuffer doAllocate(uintmax_t BufferCapacitySource) noexcept {
-            return {Array<uint8_t>(BufferCapacitySource)};
+            return {Array<uint8_t>(BufferCapacitySource, MemoryAllocator<uint8_t>(MappedMemoryResource::getInstance()))};
         }
 
         void doCompact() noexcept {
@@ -104,6 +104,31 @@ namespace eLibrary::IO {
             return BufferContainer.getElement(ValueIndex);
         }
 
+        /**
+         * Writes the view as UTF-8 at the current position
+         */
+        void setValue(const StringView &ValueSource) {
+            uintmax_t ValueSize = ValueSource.getU8Size();
+            if (ValueSize > getRemaining()) doThrowChecked(IOException, u"ByteBuffer::setValue(const StringView&) ValueSource"_S);
+            ValueSource.doEncodeU8(BufferContainer.getElementContainer() + BufferPosition);
+            BufferPosition += ValueSize;
+        }
+
+        /**
+         * Writes the builder contents as UTF-8 at the current position, chunk by chunk without flattening them
+         */
+        void setValue(const StringBuilder &ValueSource) {
+            uintmax_t ValueSize = 0;
+            ValueSource.doTraverse([&](const StringView &ValueCurrent) {
+                ValueSize += ValueCurrent.getU8Size();
+            });
+            if (ValueSize > getRemaining()) doThrowChecked(IOException, u"ByteBuffer::setValue(const StringBuilder&) ValueSource"_S);
+            ValueSource.doTraverse([&](const StringView &ValueCurrent) {
+                ValueCurrent.doEncodeU8(BufferContainer.getElementContainer() + BufferPosition);
+                BufferPosition += ValueCurrent.getU8Size();
+            });
+        }
+
         void setValue(uint8_t ValueSource) {
             if (BufferPosition >= BufferLimit) doThrowChecked(IOException, u"ByteBuffer::setValue(uint8_t) BufferPosition"_S);
             BufferContainer.getElement(BufferPosition++) = ValueSource;
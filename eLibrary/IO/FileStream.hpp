@@ -107,6 +107,8 @@ namespace eLibrary::IO {
             ::lseek((int) StreamDescriptor, FileOffset, FileOrigin);
         }
 
+        using OutputStream::doWrite;
+
         void doWrite(uint8_t FileCharacter) override {
             if (!isAvailable()) doThrowChecked(IOException, u"FileOutputStream::doWrite(uint8_t) isAvailable"_S);
             ::write((int) StreamDescriptor, &FileCharacter, 1);
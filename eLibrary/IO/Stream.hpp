@@ -46,6 +46,25 @@ namespace eLibrary::IO {
                 doWrite(StreamBuffer.getValue());
         }
 
+        /**
+         * Writes the builder contents as UTF-8, encoding one chunk at a time instead of flattening them into a string
+         */
+        void doWrite(const StringBuilder &StreamSource) {
+            if (!isAvailable()) doThrowChecked(IOException, u"OutputStream::doWrite(const StringBuilder&) isAvailable"_S);
+            uintmax_t StreamBufferSize = 0;
+            StreamSource.doTraverse([&](const StringView &StreamCurrent) {
+                StreamBufferSize = Objects::getMaximum(StreamBufferSize, (uintmax_t) StreamCurrent.getCharacterSize() * 3);
+            });
+            if (!StreamBufferSize) return;
+            ByteBuffer StreamBuffer(ByteBuffer::doAllocate(StreamBufferSize));
+            StreamSource.doTraverse([&](const StringView &StreamCurrent) {
+                StreamBuffer.doClear();
+                StreamBuffer.setValue(StreamCurrent);
+                StreamBuffer.doFlip();
+                doWrite(StreamBuffer);
+            });
+        }
+
         virtual bool isAvailable() const noexcept {
             return false;
         }
@@ -14,12 +14,13 @@ namespace eLibrary::Multimedia {
         Array<Array<uint8_t>> AudioData;
         uintmax_t AudioDataSize = 0;
         int AudioSampleRate = 0;
-        mutable MemoryAllocator<uint8_t> AudioAllocator;
+        // Channel data of long recordings reaches the mapped threshold, where faulting in huge pages spares the TLB
+        mutable MemoryAllocator<uint8_t> AudioAllocator{MappedMemoryResource::getInstance()};
 
         AudioSegment(const ::std::vector<std::vector<uint8_t>> &AudioDataSource, const MediaChannelLayout &AudioChannelLayoutSource, int AudioSampleRateSource) : AudioChannelLayout(AudioChannelLayoutSource), AudioDataSize(AudioDataSource[0].size()), AudioSampleRate(AudioSampleRateSource) {
             AudioData = Array<Array<uint8_t>>(AudioDataSource.size());
             for (uint8_t AudioChannel = 0;AudioChannel < AudioChannelLayout.getChannelCount();++AudioChannel)
-                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSource[AudioChannel].begin(), AudioDataSource[AudioChannel].end());
+                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSource[AudioChannel].begin(), AudioDataSource[AudioChannel].end(), AudioAllocator);
         }
 
         AudioSegment(const Array<Array<uint8_t>> &AudioDataSource, const MediaChannelLayout &AudioChannelLayoutSource, int AudioSampleRateSource) : AudioChannelLayout(AudioChannelLayoutSource), AudioDataSize(AudioDataSource.getElement(0).getElementSize()), AudioSampleRate(AudioSampleRateSource) {
@@ -31,7 +32,7 @@ namespace eLibrary::Multimedia {
         AudioSegment(uint8_t **AudioDataSource, uintmax_t AudioDataSourceSize, const MediaChannelLayout &AudioChannelLayoutSource, int AudioSampleRateSource) : AudioChannelLayout(AudioChannelLayoutSource), AudioDataSize(AudioDataSourceSize), AudioSampleRate(AudioSampleRateSource) {
             AudioData = Array<Array<uint8_t>>(AudioChannelLayoutSource.getChannelCount());
             for (uint8_t AudioChannel = 0;AudioChannel < AudioChannelLayout.getChannelCount();++AudioChannel)
-                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSource[AudioChannel], AudioDataSource[AudioChannel] + AudioDataSize);
+                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSource[AudioChannel], AudioDataSource[AudioChannel] + AudioDataSize, AudioAllocator);
             for (uint8_t AudioChannel = 0;AudioChannel < AudioChannelLayout.getChannelCount();++AudioChannel)
                 AudioAllocator.doDeallocate(AudioDataSource[AudioChannel], AudioDataSourceSize);
             MemoryAllocator<uint8_t*>::deleteArray(AudioDataSource);
@@ -46,7 +47,7 @@ namespace eLibrary::Multimedia {
             AudioDataSize = AudioSource.AudioDataSize;
             AudioSampleRate = AudioSource.AudioSampleRate;
             for (uint8_t AudioChannel = 0;AudioChannel < AudioChannelLayout.getChannelCount();++AudioChannel) {
-                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSize);
+                AudioData.getElement(AudioChannel) = Array<uint8_t>(AudioDataSize, AudioAllocator);
                 Collections::doCopy(AudioSource.AudioData.getElement(AudioChannel).begin(), AudioDataSize, AudioData.getElement(AudioChannel).begin());
             }
         }
@@ -119,7 +120,7 @@ namespace eLibrary::Multimedia {
                 else if (AudioStatus != AVERROR(EAGAIN))
                     doThrowChecked(MediaException, u"AudioSegment::doExport(const String&) avcodec_receive_packet"_S);
             }
-            MemoryAllocator<uint8_t>::deleteArray(AudioDataSample);
+            AudioAllocator.doDeallocate(AudioDataSample, AudioChannelLayout.getChannelCount() * AudioCodecContext->frame_size);
             AudioFormatContext.doWriteTrailer();
         }
 
@@ -210,7 +211,7 @@ namespace eLibrary::Multimedia {
         }
 
         OpenAL::MediaBuffer toMediaBuffer() const {
-            Array<uint8_t> AudioDataOutput(AudioDataSize * AudioChannelLayout.getChannelCount());
+            Array<uint8_t> AudioDataOutput(AudioDataSize * AudioChannelLayout.getChannelCount(), AudioAllocator);
             AVChannelLayout AudioChannelLayoutSource(AudioChannelLayout.toFFMpegFormat());
             FFMpeg::MediaSWRContext AudioSWRContext(FFMpeg::MediaSWRContext::doAllocate(&AudioChannelLayoutSource, &AudioChannelLayoutSource, AV_SAMPLE_FMT_U8P, AV_SAMPLE_FMT_U8, AudioSampleRate, AudioSampleRate));
             AudioSWRContext.doInitialize();
@@ -305,6 +305,8 @@ namespace eLibrary::Network {
 
         SocketOutputStream(StreamSocket &SocketSource) noexcept : SocketDescriptor(SocketSource) {}
     public:
+        using OutputStream::doWrite;
+
         void doWrite(uint8_t SocketCharacter) override {
             if (!isAvailable()) doThrowChecked(NetworkException, u"SocketOutputStream::doWrite(uint8_t) isAvailable"_S);
             if (::send((int) SocketDescriptor.SocketDescriptor, (char*) &SocketCharacter, 1, 0) < 0)
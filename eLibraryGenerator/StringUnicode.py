@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+Generates eLibrary/Core/StringUnicode.cpp from the Unicode Character Database.
+
+Usage: StringUnicode.py <UCD directory> <output file> [<Unicode version>]
+
+The directory must contain UnicodeData.txt, DerivedCoreProperties.txt and
+GraphemeBreakProperty.txt (found either at the top level or under auxiliary/).
+The version comes from the headers of the last two files, which must agree with
+each other and with the pinned version when one is given, and is recorded in
+the generated header. Version 15.1.0 or later is required for the InCB values.
+Every property becomes a constexpr three-stage trie: a block index per
+DataBlockSize code points, deduplicated blocks of value indices, and a table
+of the distinct values.
+"""
+
+import os
+import re
+import sys
+
+CHARACTER_LIMIT = 0x110000
+DATA_BLOCK_SIZE = 128
+
+# Enumerator orders must match eLibrary/Core/StringUnicode.hpp
+DERIVED_PROPERTY_LIST = [
+    'Math', 'Alphabetic', 'Lowercase', 'Uppercase', 'Cased', 'Case_Ignorable',
+    'Changes_When_Lowercased', 'Changes_When_Uppercased', 'Changes_When_Titlecased',
+    'Changes_When_Casefolded', 'Changes_When_Casemapped', 'ID_Start', 'ID_Continue',
+    'XID_Start', 'XID_Continue', 'Default_Ignorable_Code_Point', 'Grapheme_Extend',
+    'Grapheme_Base', 'Grapheme_Link', 'InCB_Linker', 'InCB_Consonant', 'InCB_Extend',
+]
+GENERAL_CATEGORY_LIST = [
+    'Cc', 'Zs', 'Po', 'Sc', 'Ps', 'Pe', 'Sm', 'Pd', 'Nd', 'Lu', 'Sk', 'Pc', 'Ll', 'So', 'Lo',
+    'Pi', 'Cf', 'No', 'Pf', 'Lt', 'Lm', 'Mn', 'Cn', 'Me', 'Mc', 'Nl', 'Zl', 'Zp', 'Cs', 'Co',
+]
+GRAPHEME_BREAK_LIST = [
+    'Unassigned', 'Prepend', 'CR', 'LF', 'Control', 'Extend', 'Regional_Indicator',
+    'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT', 'ZWJ',
+]
+
+
+def get_data_path(data_directory, data_name):
+    for data_path in (os.path.join(data_directory, data_name), os.path.join(data_directory, 'auxiliary', data_name)):
+        if os.path.exists(data_path):
+            return data_path
+    raise FileNotFoundError(data_name)
+
+
+def get_data_line(data_directory, data_name):
+    with open(get_data_path(data_directory, data_name), encoding='utf-8') as data_file:
+        for data_line in data_file:
+            data_line = data_line.split('#', 1)[0].strip()
+            if data_line:
+                yield [data_field.strip() for data_field in data_line.split(';')]
+
+
+def get_data_version(data_directory, data_name):
+    with open(get_data_path(data_directory, data_name), encoding='utf-8') as data_file:
+        data_match = re.match(r'#\s*%s-(\d+\.\d+\.\d+)\.txt' % re.escape(os.path.splitext(data_name)[0]), data_file.readline())
+    if not data_match:
+        raise ValueError('%s has no version header' % data_name)
+    return data_match.group(1)
+
+
+def get_data_range(data_field):
+    if '..' in data_field:
+        range_start, range_stop = data_field.split('..')
+        return range(int(range_start, 16), int(range_stop, 16) + 1)
+    return range(int(data_field, 16), int(data_field, 16) + 1)
+
+
+def load_unicode_data(data_directory):
+    category_list = ['Cn'] * CHARACTER_LIMIT
+    mapping_list = [(0, 0, 0)] * CHARACTER_LIMIT
+    range_start = None
+    for data_field in get_data_line(data_directory, 'UnicodeData.txt'):
+        character_value = int(data_field[0], 16)
+        if data_field[1].endswith(', First>'):
+            range_start = character_value
+            continue
+        if data_field[1].endswith(', Last>'):
+            for character_current in range(range_start, character_value + 1):
+                category_list[character_current] = data_field[2]
+            continue
+        category_list[character_value] = data_field[2]
+        mapping_upper = int(data_field[12], 16) if data_field[12] else character_value
+        mapping_lower = int(data_field[13], 16) if data_field[13] else character_value
+        mapping_title = int(data_field[14], 16) if data_field[14] else mapping_upper
+        mapping_list[character_value] = (mapping_lower - character_value, mapping_title - character_value, mapping_upper - character_value)
+    return category_list, mapping_list
+
+
+def load_derived_core(data_directory):
+    property_list = [0] * CHARACTER_LIMIT
+    for data_field in get_data_line(data_directory, 'DerivedCoreProperties.txt'):
+        property_name = '_'.join(data_field[1:])
+        if property_name not in DERIVED_PROPERTY_LIST:
+            continue
+        for character_value in get_data_range(data_field[0]):
+            property_list[character_value] |= 1 << DERIVED_PROPERTY_LIST.index(property_name)
+    return property_list
+
+
+def load_grapheme_break(data_directory):
+    break_list = ['Unassigned'] * CHARACTER_LIMIT
+    for data_field in get_data_line(data_directory, 'GraphemeBreakProperty.txt'):
+        if data_field[1] not in GRAPHEME_BREAK_LIST:
+            continue
+        for character_value in get_data_range(data_field[0]):
+            break_list[character_value] = data_field[1]
+    return break_list
+
+
+def get_index_type(index_size):
+    return 'uint8_t' if index_size <= 0x100 else 'uint16_t'
+
+
+def get_trie(value_list, value_default):
+    value_table = [value_default] + sorted(set(value_list) - {value_default})
+    value_index = {value_current: value_position for value_position, value_current in enumerate(value_table)}
+    block_table = {}
+    block_index = []
+    for block_start in range(0, CHARACTER_LIMIT, DATA_BLOCK_SIZE):
+        block_current = tuple(value_index[value_current] for value_current in value_list[block_start:block_start + DATA_BLOCK_SIZE])
+        block_index.append(block_table.setdefault(block_current, len(block_table)))
+    return value_table, list(block_table), block_index
+
+
+def get_row(value_list, value_width):
+    for value_start in range(0, len(value_list), value_width):
+        yield value_list[value_start:value_start + value_width]
+
+
+def write_trie(output_list, value_type, value_format, value_trie):
+    value_table, block_table, block_index = value_trie
+    output_list.append('        static constexpr size_t DataBlockSize = %d;' % DATA_BLOCK_SIZE)
+    output_list.append('        static constexpr %s DataValue[] = {' % value_type)
+    for value_row in get_row([value_format(value_current) for value_current in value_table], 8):
+        output_list.append('                ' + ' '.join('%s,' % value_current for value_current in value_row))
+    output_list.append('        };')
+    output_list.append('        static constexpr %s DataBlock[][DataBlockSize] = {' % get_index_type(len(value_table)))
+    for block_current in block_table:
+        output_list.append('                {')
+        for block_row in get_row(block_current, 32):
+            output_list.append('                        ' + ' '.join('%d,' % value_current for value_current in block_row))
+        output_list.append('                },')
+    output_list.append('        };')
+    output_list.append('        static constexpr %s DataBlockIndex[] = {' % get_index_type(len(block_table)))
+    for index_row in get_row(block_index, 32):
+        output_list.append('                ' + ' '.join('%d,' % index_current for index_current in index_row))
+    output_list.append('        };')
+    output_list.append('')
+
+
+QUERY_SOURCE = '''            if (CharacterIndex >= DataBlockSize * (sizeof(DataBlockIndex) / sizeof(*DataBlockIndex))) [[unlikely]] return DataValue[0];
+            return DataValue[DataBlock[DataBlockIndex[CharacterIndex / DataBlockSize]][CharacterIndex % DataBlockSize]];'''
+
+
+def write_source(output_path, data_version, category_list, mapping_list, property_list, break_list):
+    output_list = [
+        '// Generated by eLibraryGenerator/StringUnicode.py from the Unicode Character Database %s, do not edit' % data_version,
+        '#include <Core/StringUnicode.hpp>',
+        '',
+        'namespace eLibrary::Core {',
+        '    namespace CharacterCaseMappingSimple {',
+    ]
+    write_trie(output_list, 'CharacterCaseMapping', lambda value_current: '{%d, %d, %d}' % value_current, get_trie(mapping_list, (0, 0, 0)))
+    output_list += [
+        '        const CharacterCaseMapping &doQuery(char32_t CharacterIndex) noexcept {',
+        QUERY_SOURCE,
+        '        }',
+        '',
+        '        bool isContains(char32_t CharacterIndex) noexcept {',
+        '            return &doQuery(CharacterIndex) != DataValue;',
+        '        }',
+        '    }',
+        '',
+        '    namespace CharacterDerivedCore {',
+    ]
+    write_trie(output_list, 'uintmax_t', str, get_trie(property_list, 0))
+    output_list += [
+        '        uintmax_t doQuery(char32_t CharacterIndex) noexcept {',
+        QUERY_SOURCE,
+        '        }',
+        '    }',
+        '',
+        '    namespace CharacterGeneralCategory {',
+    ]
+    write_trie(output_list, 'CharacterGeneralCategory', str, get_trie(category_list, 'Cn'))
+    output_list += [
+        '        CharacterGeneralCategory doQuery(char32_t CharacterIndex) noexcept {',
+        QUERY_SOURCE,
+        '        }',
+        '    }',
+        '',
+        '    namespace CharacterGraphemeBreak {',
+    ]
+    write_trie(output_list, 'CharacterGraphemeBreak', lambda value_current: 'CharacterGraphemeBreak::' + value_current, get_trie(break_list, 'Unassigned'))
+    output_list += [
+        '        CharacterGraphemeBreak doQuery(char32_t CharacterIndex) noexcept {',
+        QUERY_SOURCE,
+        '        }',
+        '    }',
+        '}',
+        '',
+    ]
+    with open(output_path, 'w', encoding='utf-8', newline='\n') as output_file:
+        output_file.write('\n'.join(output_list))
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit('Usage: StringUnicode.py <UCD directory> <output file> [<Unicode version>]')
+    data_version = {get_data_version(sys.argv[1], data_name) for data_name in ('DerivedCoreProperties.txt', 'GraphemeBreakProperty.txt')}
+    if len(data_version) != 1:
+        sys.exit('UCD files disagree on the Unicode version: %s' % ', '.join(sorted(data_version)))
+    data_version = data_version.pop()
+    if len(sys.argv) == 4 and sys.argv[3] != data_version:
+        sys.exit('UCD files are version %s but %s is pinned' % (data_version, sys.argv[3]))
+    category_list, mapping_list = load_unicode_data(sys.argv[1])
+    write_source(sys.argv[2], data_version, category_list, mapping_list, load_derived_core(sys.argv[1]), load_grapheme_break(sys.argv[1]))
+
+
+if __name__ == '__main__':
+    main()
@@ -48,6 +48,23 @@ TEST_SUITE("Container") {
         CHECK_EQ(AnyInteger.getValueType(), &typeid(String));
         CHECK(AnyInteger.getValue<String>().toU8String() == "Any");
         CHECK_THROWS(AnyInteger.getValue<Integer>());
+
+        Any AnyNumber = 1;
+        AnyNumber.getReference<int>() += 1;
+        CHECK_EQ(AnyNumber.getReference<int>(), 2);
+        Any AnyNumberCopy(AnyNumber);
+        CHECK_EQ(AnyNumberCopy.getValue<int>(), 2);
+        CHECK_EQ(AnyNumber.doRelease<int>(), 2);
+        CHECK_FALSE(AnyNumber.hasValue());
+        CHECK_THROWS(AnyNumber.getReference<int>());
+
+        Any AnyString = AnyInteger;
+        CHECK(AnyString.getReference<String>().toU8String() == "Any");
+        AnyInteger = Objects::doMove(AnyString);
+        CHECK_FALSE(AnyString.hasValue());
+        String AnyStringValue = AnyInteger.doRelease<String>();
+        CHECK(AnyStringValue.toU8String() == "Any");
+        CHECK_FALSE(AnyInteger.hasValue());
     }
 
     TEST_CASE("ArrayList") {
@@ -70,6 +87,156 @@ TEST_SUITE("Container") {
         CHECK(NumberList.doUnion(NumberList).doDifference(NumberList).isEmpty());
     }
 
+    TEST_CASE("BTreeMap") {
+        StatisticsMemoryResource MemoryResourceAscending, MemoryResourceDescending;
+        BTreeMap<uintmax_t, uintmax_t> NumberMapAscending(&MemoryResourceAscending), NumberMapDescending(&MemoryResourceDescending);
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+            NumberMapAscending.setMapping(NumberIndex, NumberIndex);
+            NumberMapDescending.setMapping(9999 - NumberIndex, 9999 - NumberIndex);
+        }
+        auto NodeSizeFunction = [](StatisticsMemoryResource &MemoryResourceSource) {
+            StatisticsMemoryResource::StatisticsSnapshot MemorySnapshot(MemoryResourceSource.getSnapshot());
+            return MemorySnapshot.AcquireCount - MemorySnapshot.ReleaseCount;
+        };
+        // Every split leaves both halves with at least 16 keys, so no insertion order strands a sparse leaf
+        CHECK_LE(NodeSizeFunction(MemoryResourceAscending), 10000 / 16 + 10000 / 256 + 4);
+        CHECK_LE(NodeSizeFunction(MemoryResourceDescending), 10000 / 16 + 10000 / 256 + 4);
+        CHECK_GE(NodeSizeFunction(MemoryResourceDescending), 10000 / 17);
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            if (NumberIndex % 10) NumberMapAscending.removeMapping(NumberIndex * 7919 % 10000);
+        CHECK_EQ(NumberMapAscending.getElementSize(), 1000);
+        CHECK_LE(NodeSizeFunction(MemoryResourceAscending), 1000 / 16 + 16);
+        uintmax_t NumberPrevious = 0, NumberSize = 0;
+        NumberMapAscending.doOrder([&](uintmax_t NumberKey, uintmax_t NumberValue) {
+            if (NumberSize++) CHECK_LT(NumberPrevious, NumberKey);
+            CHECK_EQ(NumberKey, NumberValue);
+            NumberPrevious = NumberKey;
+        });
+        CHECK_EQ(NumberSize, 1000);
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            CHECK_EQ(NumberMapAscending.isContainsKey(NumberIndex * 7919 % 10000), NumberIndex % 10 == 0);
+        CHECK_THROWS_AS(NumberMapAscending.removeMapping(10000), IndexException);
+        NumberMapAscending.doClear();
+        NumberMapDescending.doClear();
+        CHECK_EQ(MemoryResourceAscending.getSnapshot().LiveSize, 0);
+        CHECK_EQ(MemoryResourceDescending.getSnapshot().LiveSize, 0);
+
+        // Keys of equal length, since String orders shorter strings first
+        BTreeMap<String, uintmax_t> CharacterMap;
+        ::std::map<::std::u16string, uintmax_t> CharacterMapExpected;
+        for (uintmax_t NumberIndex = 0;NumberIndex < 5000;++NumberIndex) {
+            String CharacterKey(u"eLibrary.BTreeMap.Key."_S.doConcat(String::valueOf(RandomEngine() % 4000 + 10000)));
+            CharacterMap.setMapping(CharacterKey, NumberIndex);
+            CharacterMapExpected[CharacterKey.toU16String()] = NumberIndex;
+            if (NumberIndex % 3 == 0) {
+                String CharacterRemove(u"eLibrary.BTreeMap.Key."_S.doConcat(String::valueOf(RandomEngine() % 4000 + 10000)));
+                if (CharacterMap.isContainsKey(CharacterRemove)) CharacterMap.removeMapping(CharacterRemove);
+                CharacterMapExpected.erase(CharacterRemove.toU16String());
+            }
+        }
+        CHECK_EQ(CharacterMap.getElementSize(), CharacterMapExpected.size());
+        auto CharacterExpected = CharacterMapExpected.begin();
+        CharacterMap.doOrder([&](const String &CharacterKey, uintmax_t CharacterValue) {
+            CHECK(CharacterKey.toU16String() == CharacterExpected->first);
+            CHECK_EQ(CharacterValue, CharacterExpected->second);
+            ++CharacterExpected;
+        });
+        BTreeMap<String, uintmax_t> CharacterMapCopy(CharacterMap, CharacterMap.getMemoryResource());
+        CHECK_EQ(CharacterMapCopy.getElementSize(), CharacterMapExpected.size());
+        for (auto &[CharacterKey, CharacterValue] : CharacterMapExpected)
+            CHECK_EQ(CharacterMapCopy.getElement(String(CharacterKey)), CharacterValue);
+        BTreeMap<uintmax_t, uintmax_t> NumberMap;
+        for (uintmax_t NumberIndex = 3;NumberIndex;--NumberIndex) NumberMap.setMapping(NumberIndex, NumberIndex * 10);
+        CHECK_EQ(NumberMap.toString().toU16String(), u"{1:10 2:20 3:30 }");
+    }
+
+    TEST_CASE("BTreeSet") {
+        StatisticsMemoryResource MemoryResourceObject;
+        BTreeSet<uintmax_t> NumberSet1(&MemoryResourceObject), NumberSet2;
+        ::std::set<uintmax_t> NumberSetExpected1, NumberSetExpected2;
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+            uintmax_t NumberElement1 = RandomEngine() % 20000, NumberElement2 = RandomEngine() % 20000;
+            NumberSet1.addElement(NumberElement1);
+            NumberSetExpected1.insert(NumberElement1);
+            NumberSet2.addElement(NumberElement2);
+            NumberSetExpected2.insert(NumberElement2);
+        }
+        auto CheckFunction = [](const BTreeSet<uintmax_t> &NumberSetSource, const ::std::vector<uintmax_t> &NumberSetExpected) {
+            ::std::vector<uintmax_t> NumberSetActual;
+            NumberSetSource.doTraverse([&](uintmax_t NumberElement) {
+                NumberSetActual.push_back(NumberElement);
+            });
+            CHECK_EQ(NumberSetSource.getElementSize(), NumberSetExpected.size());
+            CHECK(NumberSetActual == NumberSetExpected);
+        };
+        ::std::vector<uintmax_t> NumberSetExpected;
+        ::std::set_difference(NumberSetExpected1.begin(), NumberSetExpected1.end(), NumberSetExpected2.begin(), NumberSetExpected2.end(), ::std::back_inserter(NumberSetExpected));
+        CheckFunction(NumberSet1.doDifference(NumberSet2), NumberSetExpected);
+        NumberSetExpected.clear();
+        ::std::set_intersection(NumberSetExpected1.begin(), NumberSetExpected1.end(), NumberSetExpected2.begin(), NumberSetExpected2.end(), ::std::back_inserter(NumberSetExpected));
+        CheckFunction(NumberSet1.doIntersection(NumberSet2), NumberSetExpected);
+        NumberSetExpected.clear();
+        ::std::set_union(NumberSetExpected1.begin(), NumberSetExpected1.end(), NumberSetExpected2.begin(), NumberSetExpected2.end(), ::std::back_inserter(NumberSetExpected));
+        {
+            StatisticsMemoryResource::StatisticsSnapshot MemorySnapshot(MemoryResourceObject.getSnapshot());
+            BTreeSet<uintmax_t> NumberSetUnion(NumberSet1.doUnion(NumberSet2));
+            CheckFunction(NumberSetUnion, NumberSetExpected);
+            // The merged result is appended in order, so its leaves come out packed
+            CHECK_LE(MemoryResourceObject.getSnapshot().AcquireCount - MemorySnapshot.AcquireCount, NumberSetExpected.size() / 32 + NumberSetExpected.size() / 1024 + 8);
+            for (uintmax_t NumberElement : NumberSetExpected) NumberSetUnion.removeElement(NumberElement);
+            CHECK(NumberSetUnion.isEmpty());
+        }
+        CHECK(NumberSet1.doDifference(NumberSet1).isEmpty());
+        CHECK(NumberSet1.doIntersection(BTreeSet<uintmax_t>()).isEmpty());
+        CheckFunction(BTreeSet<uintmax_t>().doUnion(NumberSet2), {NumberSetExpected2.begin(), NumberSetExpected2.end()});
+        NumberSet1.doClear();
+        CHECK_EQ(MemoryResourceObject.getSnapshot().LiveSize, 0);
+
+        BTreeSet<String> CharacterSet1, CharacterSet2;
+        for (intmax_t NumberIndex = 0;NumberIndex < 1000;++NumberIndex) {
+            CharacterSet1.addElement(u"eLibrary.BTreeSet.Element."_S.doConcat(String::valueOf(NumberIndex)));
+            CharacterSet2.addElement(u"eLibrary.BTreeSet.Element."_S.doConcat(String::valueOf(NumberIndex + 500)));
+        }
+        CHECK_EQ(CharacterSet1.doIntersection(CharacterSet2).getElementSize(), 500);
+        CHECK_EQ(CharacterSet1.doUnion(CharacterSet2).getElementSize(), 1500);
+        BTreeSet<String> CharacterSetDifference(CharacterSet1.doDifference(CharacterSet2));
+        CHECK_EQ(CharacterSetDifference.getElementSize(), 500);
+        CHECK(CharacterSetDifference.isContains(u"eLibrary.BTreeSet.Element.499"_S));
+        CHECK_FALSE(CharacterSetDifference.isContains(u"eLibrary.BTreeSet.Element.500"_S));
+        BTreeSet<intmax_t> NumberSet3;
+        for (intmax_t NumberIndex = 5;NumberIndex > 0;--NumberIndex)
+            NumberSet3.addElement(NumberIndex);
+        CHECK_EQ(NumberSet3.toString().toU16String(), u"{1 2 3 4 5 }");
+    }
+
+    TEST_CASE("Collections::doCopy&doFill&doMove") {
+        MonotonicMemoryResource MemoryResourceObject(1 << 16);
+        ArrayList<intmax_t> NumberList(&MemoryResourceObject);
+        for (intmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            NumberList.addElement(NumberIndex);
+        NumberList.doReverse();
+        for (intmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            CHECK_EQ(NumberList.getElement(NumberIndex), 9999 - NumberIndex);
+        ArrayList<String> CharacterList;
+        for (intmax_t NumberIndex = 0;NumberIndex < 1000;++NumberIndex)
+            CharacterList.addElement(String::valueOf(NumberIndex));
+        for (intmax_t NumberIndex = 0;NumberIndex < 1000;++NumberIndex)
+            CHECK_EQ(CharacterList.getElement(NumberIndex).doCompare(String::valueOf(NumberIndex)), 0);
+        intmax_t NumberArray[16];
+        Collections::doFill(NumberArray, NumberArray + 16, 0);
+        CHECK_EQ(NumberArray[15], 0);
+        for (intmax_t NumberIndex = 0;NumberIndex < 16;++NumberIndex) NumberArray[NumberIndex] = NumberIndex;
+        Collections::doCopyBackward(NumberArray, NumberArray + 8, NumberArray + 12);
+        for (intmax_t NumberIndex = 0;NumberIndex < 8;++NumberIndex)
+            CHECK_EQ(NumberArray[NumberIndex + 4], NumberIndex);
+        Collections::doMove(NumberArray + 4, 8, NumberArray);
+        CHECK_EQ(NumberArray[0], 0);
+        CHECK_EQ(NumberArray[7], 7);
+        char CharacterArray[8];
+        Collections::doFill(CharacterArray, CharacterArray + 8, 'e');
+        CHECK_EQ(CharacterArray[7], 'e');
+    }
+
     TEST_CASE("DoubleLinkedList") {
         DoubleLinkedList<NumberBuiltin<uintmax_t>> NumberList;
         for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
@@ -97,6 +264,25 @@ TEST_SUITE("Container") {
             return Number1 + Number2;
         };
         CHECK_EQ(FunctionAddLambda(1, 2), 3);
+        Array<intmax_t> NumberArray(64);
+        NumberArray.getElement(0) = 1;
+        Function<int(int, int)> FunctionAddCapture = [NumberArray](int Number1, int Number2) {
+            return Number1 + Number2 + (int) NumberArray.getElement(0);
+        };
+        Function<int(int, int)> FunctionAddCopy(FunctionAddCapture);
+        CHECK_EQ(FunctionAddCopy(1, 2), 4);
+        PointerUnique<int> NumberPointer(new int(3));
+        auto FunctionAddUniqueLambda = [NumberPointer = Objects::doMove(NumberPointer)](int Number1, int Number2) {
+            return Number1 + Number2 + *NumberPointer;
+        };
+        CHECK_FALSE(::std::is_constructible_v<Function<int(int, int)>, decltype(FunctionAddUniqueLambda)>);
+        MoveOnlyFunction<int(int, int)> FunctionAddUnique(Objects::doMove(FunctionAddUniqueLambda));
+        CHECK_FALSE(::std::is_copy_constructible_v<MoveOnlyFunction<int(int, int)>>);
+        CHECK_FALSE(::std::is_copy_assignable_v<MoveOnlyFunction<int(int, int)>>);
+        CHECK(::std::is_copy_constructible_v<Function<int(int, int)>>);
+        MoveOnlyFunction<int(int, int)> FunctionAddMove(Objects::doMove(FunctionAddUnique));
+        CHECK(FunctionAddUnique.isEmpty());
+        CHECK_EQ(FunctionAddMove(1, 2), 6);
     }
 
     TEST_CASE("Functions::doBind&doInvoke") {
@@ -109,6 +295,56 @@ TEST_SUITE("Container") {
         CHECK_EQ(Functions::doBind(&FunctionAdder::doAdd, &AdderObject, 1, 2)(), 3);
     }
 
+    TEST_CASE("HashMap") {
+        HashMap<NumberBuiltin<uintmax_t>, uintmax_t> NumberMap;
+        ArrayList<NumberBuiltin<uintmax_t>> NumberList;
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+            NumberList.addElement(RandomEngine64());
+            NumberMap.setMapping(NumberList.getElement(-1), NumberIndex);
+        }
+        CHECK_EQ(NumberMap.getElementSize(), 10000);
+        CHECK(NumberMap.isContainsValue(9999));
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;NumberIndex += 2)
+            NumberMap.removeMapping(NumberList.getElement(NumberIndex));
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            if (NumberIndex & 1) CHECK_EQ(NumberMap.getElement(NumberList.getElement(NumberIndex)), NumberIndex);
+            else CHECK_FALSE(NumberMap.isContainsKey(NumberList.getElement(NumberIndex)));
+        CHECK_THROWS_AS(NumberMap.removeMapping(NumberList.getElement(0)), IndexException);
+        HashMap<String, intmax_t> StringMap;
+        StringMap.setMapping(u"Content-Type"_S, 1);
+        StringMap.setMapping(u"Content-Type"_S, 2);
+        CHECK_EQ(StringMap.getElementSize(), 1);
+        CHECK_EQ(StringMap.getElement(String(u"Content-Type")), 2);
+    }
+
+    TEST_CASE("HashSet") {
+        StatisticsMemoryResource MemoryResourceObject;
+        HashSet<NumberBuiltin<uintmax_t>> NumberSet1(&MemoryResourceObject), NumberSet2;
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+            NumberSet1.addElement(NumberIndex);
+            NumberSet2.addElement(NumberIndex + 5000);
+        }
+        CHECK_EQ(NumberSet1.getElementSize(), 10000);
+        CHECK_GT(MemoryResourceObject.getSnapshot().LiveSize, 0);
+        CHECK_EQ(NumberSet1.doIntersection(NumberSet2).getElementSize(), 5000);
+        HashSet<NumberBuiltin<uintmax_t>> NumberSet3;
+        for (uintmax_t NumberIndex = 0;NumberIndex < 100;++NumberIndex) NumberSet3.addElement(NumberIndex * 2);
+        HashSet<NumberBuiltin<uintmax_t>> NumberSetIntersection(NumberSet1.doIntersection(NumberSet3));
+        CHECK_EQ(NumberSetIntersection.getElementSize(), 100);
+        CHECK_EQ(NumberSetIntersection.getMemoryResource(), &MemoryResourceObject);
+        CHECK_EQ(NumberSet3.doIntersection(NumberSet1).getMemoryResource(), HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberSet2.getMemoryResource(), HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberSet1.doUnion(NumberSet2).getElementSize(), 15000);
+        CHECK_EQ(NumberSet1.doDifference(NumberSet2).getElementSize(), 5000);
+        CHECK(NumberSet1.doDifference(NumberSet1).isEmpty());
+        for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
+            NumberSet1.removeElement(NumberIndex);
+        CHECK(NumberSet1.isEmpty());
+        NumberSet1.doClear();
+        NumberSetIntersection.doClear();
+        CHECK_EQ(MemoryResourceObject.getSnapshot().LiveSize, 0);
+    }
+
     TEST_CASE("RedBlackTree") {
         RedBlackTree<NumberBuiltin<intmax_t>, nullptr_t> NumberTree;
         for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex)
@@ -148,6 +384,54 @@ TEST_SUITE("Container") {
         CHECK(NumberList.doIntersection(NumberList).doDifference(NumberList).isEmpty());
         CHECK(NumberList.doUnion(NumberList).doDifference(NumberList).isEmpty());
     }
+
+    TEST_CASE("TreeMap&TreeSet") {
+        TreeMap<NumberBuiltin<intmax_t>, intmax_t> NumberMap;
+        TreeSet<NumberBuiltin<intmax_t>> NumberSet;
+        for (intmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+            NumberMap.setMapping(NumberIndex * 7919 % 10000, NumberIndex * 7919 % 10000);
+            NumberSet.addElement(NumberIndex * 2);
+        }
+        intmax_t NumberExpected = 0;
+        for (auto NumberIterator = NumberMap.begin();NumberIterator != NumberMap.end();++NumberIterator)
+            CHECK_EQ(NumberIterator.getValue(), NumberExpected++);
+        CHECK_EQ(NumberExpected, 10000);
+        auto NumberIterator = NumberMap.end();
+        while (NumberIterator != NumberMap.begin())
+            CHECK_EQ((*--NumberIterator).getValue(), --NumberExpected);
+        CHECK_EQ(NumberExpected, 0);
+        NumberMap.getLowerBound(42).getValue() = -42;
+        const TreeMap<NumberBuiltin<intmax_t>, intmax_t> &NumberMapConstant(NumberMap);
+        CHECK_EQ(NumberMapConstant.getLowerBound(42).getValue(), -42);
+        CHECK(::std::is_const_v<::std::remove_reference_t<decltype(NumberMapConstant.begin().getValue())>>);
+        CHECK_FALSE(::std::is_const_v<::std::remove_reference_t<decltype(NumberMap.begin().getValue())>>);
+        CHECK(NumberMapConstant.end() == NumberMap.end());
+        CHECK_EQ((*NumberSet.getLowerBound(101)).getValue(), 102);
+        CHECK_EQ((*NumberSet.getLowerBound(102)).getValue(), 102);
+        CHECK_EQ((*NumberSet.getUpperBound(102)).getValue(), 104);
+        CHECK(NumberSet.getUpperBound(19998) == NumberSet.end());
+        NumberSet.doRange(1000, 2000, [&](const NumberBuiltin<intmax_t> &NumberValue) {
+            CHECK_EQ(NumberValue.getValue(), 1000 + 2 * NumberExpected++);
+        });
+        CHECK_EQ(NumberExpected, 500);
+        for (const auto &NumberValue : NumberSet)
+            CHECK_EQ(NumberValue.getValue() % 2, 0);
+        StatisticsMemoryResource MemoryResourceObject;
+        ArrayList<NumberBuiltin<intmax_t>> NumberList;
+        for (intmax_t NumberIndex = 0;NumberIndex < 15000;++NumberIndex)
+            NumberList.addElement(NumberIndex * 3);
+        TreeSet<NumberBuiltin<intmax_t>> NumberSetBuild(&MemoryResourceObject);
+        NumberSetBuild.doBuild(NumberList.begin(), NumberList.end());
+        CHECK_EQ(NumberSetBuild.getElementSize(), 15000);
+        CHECK_EQ(NumberSetBuild.doIntersection(NumberSet).getElementSize(), 3334);
+        CHECK_EQ(NumberSetBuild.doUnion(NumberSet).getElementSize(), 21666);
+        CHECK_EQ(NumberSetBuild.doDifference(NumberSet).getElementSize(), 11666);
+        CHECK(NumberSetBuild.doDifference(NumberSetBuild).isEmpty());
+        CHECK_EQ(NumberSetBuild.doUnion(NumberSet).getMemoryResource(), &MemoryResourceObject);
+        NumberList.addElement(0);
+        CHECK_THROWS_AS(NumberSetBuild.doBuild(NumberList.begin(), NumberList.end()), Exception);
+        CHECK_EQ(MemoryResourceObject.getSnapshot().LiveSize, 0);
+    }
 }
 
 TEST_SUITE("Concurrent") {
@@ -173,6 +457,61 @@ TEST_SUITE("Concurrent") {
         ThreadExecutorObject.doSubmit(ThreadFunctionDecrement).get();
         ThreadExecutorObject.doSubmit(ThreadFunctionDecrement).get();
         CHECK_EQ(NumberSource.getValue(), 0);
+        CHECK_FALSE(ThreadExecutorObject.isShutdown());
+        ThreadExecutorObject.doShutdown();
+        CHECK(ThreadExecutorObject.isShutdown());
+        CHECK_THROWS(ThreadExecutorObject.doSubmit(ThreadFunctionIncrement));
+        ThreadExecutor ThreadExecutorDrain(1);
+        ::std::vector<::std::future<void>> ThreadFutureList;
+        ThreadFutureList.push_back(ThreadExecutorDrain.doSubmit([] {
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(20));
+        }));
+        for (uintmax_t NumberEpoch = 0;NumberEpoch < 100;++NumberEpoch)
+            ThreadFutureList.push_back(ThreadExecutorDrain.doSubmit([&] {
+                NumberSource.doFetchAdd(1);
+            }));
+        ThreadExecutorDrain.doShutdown();
+        for (auto &ThreadFuture : ThreadFutureList) CHECK_NOTHROW(ThreadFuture.get());
+        CHECK_EQ(NumberSource.getValue(), 100);
+    }
+
+    TEST_CASE("ConcurrentHashMap&ThreadExecutor") {
+        ConcurrentHashMap<uintmax_t, uintmax_t> NumberMap;
+        AtomicStorage<uintmax_t> NumberCompute(0);
+        auto ThreadFunction = [&](uintmax_t ThreadIndex) {
+            for (uintmax_t NumberIndex = 0;NumberIndex < 10000;++NumberIndex) {
+                NumberMap.setMapping(NumberIndex * 4 + ThreadIndex, NumberIndex);
+                NumberMap.doComputeIfAbsent(NumberIndex + 40000, [&](uintmax_t NumberKey) {
+                    NumberCompute.doFetchAdd(1);
+                    return NumberKey;
+                });
+                if (NumberIndex & 1) NumberMap.removeMapping(NumberIndex * 4 + ThreadIndex);
+            }
+        };
+        ThreadExecutor ThreadExecutorObject(4);
+        auto ThreadFuture0 = ThreadExecutorObject.doSubmit(ThreadFunction, 0);
+        auto ThreadFuture1 = ThreadExecutorObject.doSubmit(ThreadFunction, 1);
+        auto ThreadFuture2 = ThreadExecutorObject.doSubmit(ThreadFunction, 2);
+        auto ThreadFuture3 = ThreadExecutorObject.doSubmit(ThreadFunction, 3);
+        ThreadFuture0.get();
+        ThreadFuture1.get();
+        ThreadFuture2.get();
+        ThreadFuture3.get();
+        CHECK_EQ(NumberCompute.getValue(), 10000);
+        CHECK_EQ(NumberMap.getElementSize(), 30000);
+        for (uintmax_t NumberIndex = 0;NumberIndex < 40000;++NumberIndex)
+            CHECK_EQ(NumberMap.isContainsKey(NumberIndex), !((NumberIndex / 4) & 1));
+        CHECK_EQ(NumberMap.getElement(40004), 40004);
+        CHECK_THROWS_AS(NumberMap.removeMapping(1ULL << 40), IndexException);
+        StatisticsMemoryResource MemoryResourceObject;
+        {
+            ConcurrentHashMap<uintmax_t, uintmax_t> NumberMapRetire(&MemoryResourceObject);
+            for (uintmax_t NumberIndex = 0;NumberIndex < 100000;++NumberIndex)
+                NumberMapRetire.setMapping(NumberIndex & 7, NumberIndex);
+            CHECK_EQ(NumberMapRetire.getElement(7), 99999);
+            CHECK_LT(MemoryResourceObject.getSnapshot().LiveSize, 16384);
+        }
+        CHECK_EQ(MemoryResourceObject.getSnapshot().LiveSize, 0);
     }
 
     TEST_CASE("Mutex&MutexLocker&ThreadExecutor") {
@@ -186,11 +525,20 @@ TEST_SUITE("Concurrent") {
             }
         };
         ThreadExecutor ThreadExecutorObject(4);
-        ThreadExecutorObject.doSubmit(ThreadFunction).get();
-        ThreadExecutorObject.doSubmit(ThreadFunction).get();
-        ThreadExecutorObject.doSubmit(ThreadFunction).get();
-        ThreadExecutorObject.doSubmit(ThreadFunction).get();
+        auto ThreadFuture1 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture2 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture3 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture4 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        ThreadFuture1.get();
+        ThreadFuture2.get();
+        ThreadFuture3.get();
+        ThreadFuture4.get();
         CHECK_EQ(NumberSource, NumberValue * 4);
+        CHECK(NumberMutex.tryLock());
+        CHECK(NumberMutex.isLocked());
+        CHECK_FALSE(NumberMutex.tryLock());
+        NumberMutex.doUnlock();
+        CHECK_FALSE(NumberMutex.isLocked());
     }
 }
 
@@ -216,10 +564,208 @@ TEST_SUITE("IO") {
         CHECK(FileObject.isExists());
         CHECK(FileObject.isFile());
         CHECK_EQ(FileObject.getFileSize(), 10000);
+        CHECK_EQ(NumberBuffer.getBufferContainer().getMemoryResource(), MappedMemoryResource::getInstance());
+        FileObject.doRemove();
+        CHECK(!FileObject.isExists());
+    }
+
+    TEST_CASE("StringBuilder&ByteBuffer&FileOutputStream") {
+        StringBuilder StringSource;
+        ::std::string StringExpected;
+        for (uintmax_t StringEpoch = 0;StringEpoch < 5000;++StringEpoch) {
+            StringSource.addString(u"eLibrary \u00E9\U0001F600");
+            StringExpected.append("eLibrary \xC3\xA9\xF0\x9F\x98\x80");
+        }
+        IO::ByteBuffer StringBuffer(IO::ByteBuffer::doAllocate(StringExpected.size()));
+        StringBuffer.setValue(StringSource);
+        CHECK_FALSE(StringBuffer.hasRemaining());
+        CHECK_EQ(::memcmp(StringBuffer.getBufferContainer().getElementContainer(), StringExpected.data(), StringExpected.size()), 0);
+        CHECK_THROWS(StringBuffer.setValue(StringView(u"e")));
+        IO::FileOutputStream StreamOutput;
+        StreamOutput.doOpen({u"StringBuilder.tst"}, IO::FileOption::OptionBinary, IO::FileOption::OptionCreate, IO::FileOption::OptionTruncate);
+        StreamOutput.doWrite(StringSource);
+        StreamOutput.doClose();
+        IO::File FileObject(IO::File({u"StringBuilder.tst"}));
+        CHECK_EQ(FileObject.getFileSize(), StringExpected.size());
+        FileObject.doRemove();
     }
 }
 #endif
 
+TEST_SUITE("Memory") {
+    TEST_CASE("MappedMemoryResource") {
+        StatisticsMemoryResource MemoryResourceUpstream;
+        MappedMemoryResource MemoryResourceObject(65536, &MemoryResourceUpstream);
+        auto *MemoryTarget = (uint8_t*) MemoryResourceObject.doAcquire(1 << 22, 64);
+        CHECK_EQ((uintptr_t) MemoryTarget % 4096, 0);
+        ::memset(MemoryTarget, 0xFF, 1 << 22);
+        MemoryResourceObject.doRelease(MemoryTarget, 1 << 22, 64);
+        MemoryTarget = (uint8_t*) MemoryResourceObject.doAcquire(1024, 8);
+        MemoryResourceObject.doRelease(MemoryTarget, 1024, 8);
+        CHECK_EQ(MemoryResourceUpstream.getSnapshot().AcquireCount, 1);
+        MemoryTarget = (uint8_t*) MemoryResourceObject.doAcquire(65537, 64);
+        MemoryTarget[65536] = 1;
+        MemoryTarget = (uint8_t*) MemoryResourceObject.doReacquire(MemoryTarget, 65537, (1 << 21) + 1, 64);
+        CHECK_EQ(MemoryTarget[65536], 1);
+        MemoryTarget[1 << 21] = 1;
+        MemoryResourceObject.doRelease(MemoryTarget, (1 << 21) + 1, 64);
+        CHECK_EQ(MemoryResourceUpstream.getSnapshot().AcquireCount, 1);
+        Array<uint8_t> MemoryArray(1 << 22, MemoryAllocator<uint8_t>(MappedMemoryResource::getInstance()));
+        MemoryArray.getElement(-1) = 1;
+        CHECK_EQ(MemoryArray.getElement((1 << 22) - 1), 1);
+        CHECK_EQ(Array<uint8_t>(1 << 22).getMemoryResource(), HeapMemoryResource::getInstance());
+    }
+
+    TEST_CASE("MemoryResourcePropagation") {
+        StatisticsMemoryResource MemoryResourceObject;
+        ArrayList<NumberBuiltin<intmax_t>> NumberList(&MemoryResourceObject);
+        DoubleLinkedList<NumberBuiltin<intmax_t>> NumberListDouble(&MemoryResourceObject);
+        SingleLinkedList<NumberBuiltin<intmax_t>> NumberListSingle(&MemoryResourceObject);
+        TreeMap<NumberBuiltin<intmax_t>, NumberBuiltin<intmax_t>> NumberMap(&MemoryResourceObject);
+        TreeSet<NumberBuiltin<intmax_t>> NumberSet(&MemoryResourceObject);
+        StringBuilder CharacterStream(&MemoryResourceObject);
+        for (intmax_t NumberIndex = 0;NumberIndex < 100;++NumberIndex) {
+            NumberList.addElement(NumberIndex);
+            NumberListDouble.addElement(NumberIndex);
+            NumberListSingle.addElement(NumberIndex);
+            NumberMap.setMapping(NumberIndex, NumberIndex);
+            NumberSet.addElement(NumberIndex);
+            CharacterStream.addCharacter(u'0');
+        }
+        String CharacterString(CharacterStream.toString());
+        CHECK_EQ(CharacterString.getMemoryResource(), &MemoryResourceObject);
+        CHECK_GT(MemoryResourceObject.getSnapshot().LiveSize, 0);
+        ArrayList<NumberBuiltin<intmax_t>> NumberListCopy(NumberList);
+        DoubleLinkedList<NumberBuiltin<intmax_t>> NumberListDoubleMove(Objects::doMove(NumberListDouble));
+        TreeSet<NumberBuiltin<intmax_t>> NumberSetCopy(NumberSet, HeapMemoryResource::getInstance());
+        String CharacterStringCopy(CharacterString, HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberListCopy.getMemoryResource(), &MemoryResourceObject);
+        CHECK_EQ(NumberListDoubleMove.getMemoryResource(), &MemoryResourceObject);
+        CHECK_EQ(NumberListDoubleMove.getElementSize(), 100);
+        CHECK_EQ(NumberSetCopy.getMemoryResource(), HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberSetCopy.getElementSize(), 100);
+        CHECK_EQ(CharacterStringCopy.getMemoryResource(), HeapMemoryResource::getInstance());
+        CHECK_EQ(CharacterStringCopy.doCompare(CharacterString), 0);
+        NumberListSingle = SingleLinkedList<NumberBuiltin<intmax_t>>(NumberListSingle, HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberListSingle.getMemoryResource(), HeapMemoryResource::getInstance());
+        CHECK_EQ(NumberListSingle.getElementSize(), 100);
+        CHECK_EQ(NumberMap.getElement(42), 42);
+        ArrayList<bool> BooleanList(&MemoryResourceObject);
+        DoubleLinkedList<bool> BooleanListDouble(&MemoryResourceObject);
+        SingleLinkedList<bool> BooleanListSingle(&MemoryResourceObject);
+        CHECK(BooleanList.isEmpty());
+        CHECK_EQ(BooleanList.getMemoryResource(), &MemoryResourceObject);
+        CHECK(BooleanListDouble.isEmpty());
+        CHECK_EQ(BooleanListDouble.getMemoryResource(), &MemoryResourceObject);
+        CHECK(BooleanListSingle.isEmpty());
+        CHECK_EQ(BooleanListSingle.getMemoryResource(), &MemoryResourceObject);
+    }
+
+    TEST_CASE("MonotonicMemoryResource") {
+        MonotonicMemoryResource MemoryResourceObject(64);
+        MemoryAllocator<uintmax_t> MemoryAllocatorObject(&MemoryResourceObject);
+        ArrayList<uintptr_t> MemoryList;
+        for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex) {
+            auto *MemoryTarget = MemoryAllocatorObject.acquireObject(MemoryIndex);
+            CHECK_EQ((uintptr_t) MemoryTarget % alignof(uintmax_t), 0);
+            MemoryList.addElement((uintptr_t) MemoryTarget);
+        }
+        for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex)
+            CHECK_EQ(*(uintmax_t*) MemoryList.getElement(MemoryIndex), MemoryIndex);
+        MemoryResourceObject.doReset();
+        alignas(64) uint8_t MemoryBuffer[256];
+        MonotonicMemoryResource MemoryResourceBuffer(MemoryBuffer, sizeof(MemoryBuffer));
+        auto *MemoryTarget = (uint8_t*) MemoryResourceBuffer.doAcquire(128, 64);
+        CHECK(MemoryTarget >= MemoryBuffer);
+        CHECK(MemoryTarget + 128 <= MemoryBuffer + sizeof(MemoryBuffer));
+        MemoryTarget = (uint8_t*) MemoryResourceBuffer.doAcquire(1024, 64);
+        CHECK_EQ((uintptr_t) MemoryTarget % 64, 0);
+    }
+
+    TEST_CASE("PoolMemoryResource") {
+        PoolMemoryResource MemoryResourceObject(1024);
+        ArrayList<uintptr_t> MemoryList;
+        for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex) {
+            auto *MemoryTarget = (uint8_t*) MemoryResourceObject.doAcquire(MemoryIndex % 600 + 1, alignof(::std::max_align_t));
+            CHECK_EQ((uintptr_t) MemoryTarget % alignof(::std::max_align_t), 0);
+            ::memset(MemoryTarget, 0xFF, MemoryIndex % 600 + 1);
+            MemoryList.addElement((uintptr_t) MemoryTarget);
+        }
+        for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex)
+            MemoryResourceObject.doRelease((void*) MemoryList.getElement(MemoryIndex), MemoryIndex % 600 + 1, alignof(::std::max_align_t));
+        CHECK_EQ((uintptr_t) MemoryResourceObject.doAcquire(32, 8), MemoryList.getElement(9631));
+        SynchronizedPoolMemoryResource MemoryResourceSynchronized;
+        MemoryAllocator<DoubleLinkedList<uintmax_t>> MemoryAllocatorObject(&MemoryResourceSynchronized);
+        auto *MemoryListTarget = MemoryAllocatorObject.acquireObject();
+        MemoryListTarget->addElement(1);
+        CHECK_EQ(MemoryListTarget->getElement(0), 1);
+        MemoryAllocatorObject.releaseObject(MemoryListTarget);
+    }
+
+    TEST_CASE("StatisticsMemoryResource") {
+        StatisticsMemoryResource MemoryResourceObject;
+        MemoryAllocator<uintmax_t> MemoryAllocatorObject(&MemoryResourceObject);
+        uintmax_t *MemoryTarget1 = MemoryAllocatorObject.doAllocate(4);
+        uintmax_t *MemoryTarget2 = MemoryAllocatorObject.doAllocate(100);
+        MemoryAllocatorObject.doDeallocate(MemoryTarget1, 4);
+        auto MemorySnapshot = MemoryResourceObject.getSnapshot();
+        CHECK_EQ(MemorySnapshot.AcquireCount, 2);
+        CHECK_EQ(MemorySnapshot.ReleaseCount, 1);
+        CHECK_EQ(MemorySnapshot.LiveSize, 100 * sizeof(uintmax_t));
+        CHECK_EQ(MemorySnapshot.PeakSize, 104 * sizeof(uintmax_t));
+        CHECK_EQ(MemorySnapshot.HistogramList[::std::bit_width(4 * sizeof(uintmax_t))], 1);
+        CHECK_EQ(MemorySnapshot.HistogramList[::std::bit_width(100 * sizeof(uintmax_t))], 1);
+        MemoryAllocatorObject.doDeallocate(MemoryTarget2, 100);
+        MemoryResourceObject.doReset();
+        MemorySnapshot = MemoryResourceObject.getSnapshot();
+        CHECK_EQ(MemorySnapshot.AcquireCount, 0);
+        CHECK_EQ(MemorySnapshot.LiveSize, 0);
+        CHECK_EQ(MemorySnapshot.PeakSize, 0);
+        ThreadExecutor ThreadExecutorObject(1);
+        for (uintmax_t RoundIndex = 0;RoundIndex < 10;++RoundIndex) {
+            uintmax_t *MemoryTarget = MemoryAllocatorObject.doAllocate(1000);
+            ThreadExecutorObject.doSubmit([&, MemoryTarget] {
+                MemoryAllocatorObject.doDeallocate(MemoryTarget, 1000);
+            }).get();
+        }
+        MemorySnapshot = MemoryResourceObject.getSnapshot();
+        CHECK_EQ(MemorySnapshot.LiveSize, 0);
+        CHECK_EQ(MemorySnapshot.PeakSize, 1000 * sizeof(uintmax_t));
+    }
+
+    TEST_CASE("ThreadCachingMemoryResource") {
+        ThreadCachingMemoryResource MemoryResourceObject(1024);
+        auto *MemoryTarget = (uint8_t*) MemoryResourceObject.doAcquire(48, 16);
+        MemoryResourceObject.doRelease(MemoryTarget, 48, 16);
+        CHECK_EQ(MemoryResourceObject.doAcquire(40, 8), MemoryTarget);
+        MemoryResourceObject.doRelease(MemoryTarget, 40, 8);
+        auto ThreadFunction = [&]() {
+            ArrayList<uintptr_t> MemoryList;
+            for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex) {
+                auto *MemoryBlock = (uint8_t*) MemoryResourceObject.doAcquire(MemoryIndex % 600 + 1, alignof(::std::max_align_t));
+                ::memset(MemoryBlock, 0xFF, MemoryIndex % 600 + 1);
+                MemoryList.addElement((uintptr_t) MemoryBlock);
+            }
+            for (uintmax_t MemoryIndex = 0;MemoryIndex < 10000;++MemoryIndex)
+                MemoryResourceObject.doRelease((void*) MemoryList.getElement(MemoryIndex), MemoryIndex % 600 + 1, alignof(::std::max_align_t));
+        };
+        ThreadExecutor ThreadExecutorObject(4);
+        auto ThreadFuture1 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture2 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture3 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        auto ThreadFuture4 = ThreadExecutorObject.doSubmit(ThreadFunction);
+        ThreadFuture1.get();
+        ThreadFuture2.get();
+        ThreadFuture3.get();
+        ThreadFuture4.get();
+        CHECK_EQ(DoubleLinkedList<NumberBuiltin<intmax_t>>().getMemoryResource(), SynchronizedPoolMemoryResource::getInstance());
+        DoubleLinkedList<NumberBuiltin<intmax_t>> NumberList(&MemoryResourceObject);
+        for (intmax_t NumberIndex = 0;NumberIndex < 1000;++NumberIndex) NumberList.addElement(NumberIndex);
+        CHECK_EQ(NumberList.getMemoryResource(), &MemoryResourceObject);
+        CHECK_EQ(NumberList.getElementSize(), 1000);
+    }
+}
+
 #if eLibraryFeature(Multimedia)
 TEST_SUITE("Multimedia") {
     TEST_CASE("AudioSegment") {
@@ -317,12 +863,271 @@ TEST_SUITE("CharacterString") {
         return CharacterStream.toString();
     }
 
+    TEST_CASE("Character") {
+        CHECK(Type::isTriviallyRelocatable<Character>);
+        const Object &CharacterObject = Character(u'a');
+        CHECK_EQ(CharacterObject.hashCode(), u'a');
+        CHECK_EQ(CharacterObject.toString().doCompare(u"a"_S), 0);
+        String StringSource(u"a1Z"_S);
+        CHECK_FALSE(StringSource.isNull());
+        CHECK_FALSE(String(u""_S).isNull());
+        CHECK(String().isNull());
+        String StringMoved(Objects::doMove(StringSource));
+        CHECK(StringSource.isNull());
+        StringSource = StringMoved;
+        CHECK_FALSE(StringSource.isNull());
+        CHECK_EQ((char16_t) StringSource.getCharacter(0), u'a');
+        CHECK_EQ(StringSource.getCharacter(1).toNumber(10), 1);
+        CHECK_EQ(StringSource.getCharacter(-1).toNumber(36), 35);
+        CHECK(StringSource.toU16String() == u"a1Z");
+        CHECK_THROWS(StringSource.getCharacter(3));
+    }
+
     TEST_CASE("CaseConversion") {
         String StringSource(doGenerateString());
         CHECK_EQ(StringSource.toUpperCase().doCompare(StringSource.toUpperCase()), 0);
         CHECK_EQ(StringSource.toLowerCase().toUpperCase().doCompare(StringSource.toUpperCase()), 0);
         CHECK_EQ(StringSource.toLowerCase().doCompare(StringSource.toLowerCase()), 0);
         CHECK_EQ(StringSource.toUpperCase().toLowerCase().doCompare(StringSource.toLowerCase()), 0);
+        ::std::u16string StringExpected = StringSource.toU16String();
+        for (auto &StringCharacter : StringExpected) StringCharacter = (char16_t) CharacterUtility::toLowerCase(StringCharacter);
+        CHECK_EQ(StringSource.toLowerCase().toU16String(), StringExpected);
+        CHECK_EQ(String(u"Content-Type: TEXT/html; Charset=UTF-8 [@`{]"_S).toLowerCase().toU16String(), u"content-type: text/html; charset=utf-8 [@`{]");
+        CHECK_EQ(String(u"Content-Type: TEXT/html; Charset=UTF-8 [@`{]"_S).toUpperCase().toU16String(), u"CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 [@`{]");
+        CHECK_EQ(String(u"\u00C9t\u00E9 \u00B5 \u00FF"_S).toUpperCase().toU16String(), u"\u00C9T\u00C9 \u039C \u0178");
+        CHECK(String(u"\u0178ABCDEFGHIJKLMNOPQRSTUVWXYZ"_S).toLowerCase().isLatin1());
+        CHECK_EQ(String(u"\U00010400\u0391\u0392"_S).toLowerCase().toU16String(), u"\U00010428\u03B1\u03B2");
+        CHECK_EQ(CharacterUtility::toTitleCase(0x01C6), 0x01C5);
+        CHECK_FALSE(CharacterCaseMappingSimple::isContains(U'!'));
+        CHECK(CharacterCaseMappingSimple::isContains(U'a'));
+        CHECK_EQ(CharacterGeneralCategory::doQuery(0x10FFFF), CharacterGeneralCategory::Cn);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(U'\r'), CharacterGraphemeBreak::CharacterGraphemeBreak::CR);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0x0301), CharacterGraphemeBreak::CharacterGraphemeBreak::Extend);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0x200C), CharacterGraphemeBreak::CharacterGraphemeBreak::Extend);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xE0001), CharacterGraphemeBreak::CharacterGraphemeBreak::Control);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xE0020), CharacterGraphemeBreak::CharacterGraphemeBreak::Extend);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xE007F), CharacterGraphemeBreak::CharacterGraphemeBreak::Extend);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xE0080), CharacterGraphemeBreak::CharacterGraphemeBreak::Control);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0x1F1E6), CharacterGraphemeBreak::CharacterGraphemeBreak::Regional_Indicator);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xAC00), CharacterGraphemeBreak::CharacterGraphemeBreak::LV);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(0xAC01), CharacterGraphemeBreak::CharacterGraphemeBreak::LVT);
+        CHECK_EQ(CharacterGraphemeBreak::doQuery(U'a'), CharacterGraphemeBreak::CharacterGraphemeBreak::Unassigned);
+    }
+
+    TEST_CASE("Latin1String") {
+        StatisticsMemoryResource MemoryResourceObject;
+        String StringLatin1(String(u"GET /index.html HTTP/1.1\r\nHost: 127.0.0.1\r\n"_S), &MemoryResourceObject);
+        CHECK(StringLatin1.isLatin1());
+        CHECK_EQ(MemoryResourceObject.getSnapshot().LiveSize, (StringLatin1.getCharacterSize() / 2 + 1) * sizeof(char16_t));
+        CHECK_EQ(StringLatin1.doFind(u"Host"_S), 26);
+        CHECK_EQ(StringLatin1.doFind(u'/'), 4);
+        CHECK_EQ(StringLatin1.doFind(u'\u4E2D'), -1);
+        CHECK(StringLatin1.isEndswith(u"\r\n"_S));
+        CHECK(StringLatin1.toU8String() == "GET /index.html HTTP/1.1\r\nHost: 127.0.0.1\r\n");
+
+        String StringUtf16(u"\u00E9t\u00E9 \u4E2D\u6587"_S);
+        CHECK_FALSE(StringUtf16.isLatin1());
+        CHECK_EQ(StringLatin1.doFind(StringUtf16), -1);
+        String StringConcat(StringLatin1.doConcat(StringUtf16));
+        CHECK_FALSE(StringConcat.isLatin1());
+        CHECK(StringConcat.isStartswith(StringLatin1));
+        CHECK(StringConcat.isEndswith(StringUtf16));
+        CHECK_EQ(StringConcat.doFind(StringUtf16), StringLatin1.getCharacterSize());
+        String StringPrefix(StringUtf16.doTruncate(0, 3));
+        CHECK(StringPrefix.isLatin1());
+        CHECK(StringPrefix.toU8String() == "\xC3\xA9t\xC3\xA9");
+        CHECK_EQ(StringPrefix.doCompare(String(u"\u00E9t\u00E9"_S)), 0);
+        CHECK_EQ(StringPrefix.hashCode(), String(u"\u00E9t\u00E9"_S).hashCode());
+        CHECK_LT(StringPrefix.doCompare(String(u"\u00E9t\u4E2D"_S)), 0);
+        CHECK_EQ(StringPrefix.toUpperCase().doCompare(u"\u00C9T\u00C9"_S), 0);
+    }
+
+    TEST_CASE("SmallString") {
+        StatisticsMemoryResource MemoryResourceObject;
+        String StringShort(u"127.0.0.1:26916"_S, &MemoryResourceObject);
+        StringBuilder CharacterStream(&MemoryResourceObject);
+        CharacterStream.addString(StringShort);
+        String StringShortCopy(StringShort);
+        String StringShortMove(Objects::doMove(StringShortCopy));
+        CHECK_EQ(MemoryResourceObject.getSnapshot().AcquireCount, 0);
+        CHECK_EQ(StringShortMove.doCompare(CharacterStream.toString()), 0);
+        CHECK(StringShortCopy.isEmpty());
+        ::std::u16string StringWideSource(22, u'\u4E00');
+        String StringWide(StringWideSource, &MemoryResourceObject);
+        CHECK_EQ(MemoryResourceObject.getSnapshot().AcquireCount, 0);
+        CHECK_FALSE(StringWide.isLatin1());
+        CHECK_EQ(String(StringWide).toU16String(), StringWideSource);
+        CHECK_LE(sizeof(String), 88);
+
+        CharacterStream.addString(StringShort);
+        String StringLong(CharacterStream.toString());
+        CHECK_GT(MemoryResourceObject.getSnapshot().AcquireCount, 0);
+        CHECK_EQ(StringLong.getCharacterSize(), StringShort.getCharacterSize() * 2);
+        StringShortMove = StringLong;
+        CHECK_EQ(StringShortMove.doCompare(StringLong), 0);
+        StringShortMove = StringShort;
+        CHECK_EQ(StringShortMove.doCompare(StringShort), 0);
+        CHECK(StringLong.doTruncate(0, StringShort.getCharacterSize()).toU16String() == StringShort.toU16String());
+    }
+
+    TEST_CASE("StringBuilder") {
+        StringBuilder StringSource;
+        ::std::u16string StringExpected;
+        for (uintmax_t StringEpoch = 0;StringEpoch < 20000;++StringEpoch) {
+            switch (RandomEngine() % 3) {
+                case 0:
+                    StringSource.addCharacter(u'e');
+                    StringExpected.push_back(u'e');
+                    break;
+                case 1:
+                    StringSource.addCharacter(0xD83D);
+                    StringSource.addCharacter(0xDE00);
+                    StringExpected.append(u"\U0001F600");
+                    break;
+                default:
+                    StringSource.addString(u"eLibrary\U0001F600");
+                    StringExpected.append(u"eLibrary\U0001F600");
+            }
+        }
+        CHECK_EQ(StringSource.getCharacterSize(), StringExpected.size());
+        StringSource.doTraverse([](const StringView &StringCurrent) {
+            CHECK_FALSE(CharacterUtility::isHighSurrogate((char16_t) StringCurrent.getCharacter(-1)));
+        });
+        CHECK_EQ(StringSource.toString().toU16String(), StringExpected);
+        StringSource.doClear();
+        for (uintmax_t StringEpoch = 0;StringEpoch < 10000;++StringEpoch) StringSource.addString(u"eLibrary");
+        CHECK(StringSource.toString().isLatin1());
+        CHECK_EQ(StringSource.toString().getCharacterSize(), 80000);
+    }
+
+    TEST_CASE("StringHash") {
+        ::std::u16string StringSource;
+        for (intmax_t StringIndex = 0;StringIndex < 100;++StringIndex) {
+            StringSource.push_back(char16_t(RandomEngine() % 26 + u'a'));
+            String StringTarget(StringSource);
+            CHECK(StringTarget.isLatin1());
+            CHECK_EQ(StringTarget.hashCode(), StringView(StringSource.data(), (intmax_t) StringSource.size()).hashCode());
+            CHECK_EQ(String(StringTarget).hashCode(), StringTarget.hashCode());
+            CHECK_NE(StringTarget.hashCode(), String(StringSource + u'\0').hashCode());
+        }
+        String StringCached(StringSource), StringMoved(Objects::doMove(StringCached));
+        CHECK_EQ(StringMoved.hashCode(), StringView(StringSource.data(), (intmax_t) StringSource.size()).hashCode());
+        CHECK_EQ(StringCached.hashCode(), String().hashCode());
+        String StringShort(u"eLibrary"_S), StringShortOther(u"Library"_S);
+        CHECK_EQ(StringShort.hashCode(), StringView(u"eLibrary").hashCode());
+        StringShortOther.hashCode();
+        StringShort = Objects::doMove(StringShortOther);
+        CHECK_EQ(StringShort.hashCode(), StringView(u"Library").hashCode());
+        CHECK_EQ(StringShortOther.hashCode(), String().hashCode());
+        StringShort = String(u"Lib"_S);
+        CHECK_EQ(StringShort.hashCode(), StringView(u"Lib").hashCode());
+        ::std::set<uintmax_t> StringHashSet;
+        for (uint32_t StringIndex = 0;StringIndex < 10000;++StringIndex)
+            StringHashSet.insert(String::valueOf(StringIndex).hashCode());
+        CHECK_EQ(StringHashSet.size(), 10000);
+        String StringShared(StringSource);
+        uintmax_t StringSharedHash[4];
+        ThreadExecutor ThreadExecutorObject(4);
+        ::std::vector<::std::future<void>> ThreadFutureList;
+        for (auto &StringSharedHashCurrent : StringSharedHash)
+            ThreadFutureList.push_back(ThreadExecutorObject.doSubmit([&] {
+                StringSharedHashCurrent = String(StringShared).hashCode() ^ StringShared.hashCode();
+            }));
+        for (auto &ThreadFuture : ThreadFutureList) ThreadFuture.get();
+        for (uintmax_t StringSharedHashCurrent : StringSharedHash) CHECK_EQ(StringSharedHashCurrent, 0);
+    }
+
+    TEST_CASE("StringPool") {
+        const String &StringSource = String(u"eLibrary.StringPool"_S).doIntern();
+        CHECK_EQ(&StringSource, &StringPool::getInstance().doIntern(StringView(u"eLibrary.StringPool")));
+        CHECK_EQ(&StringSource, &String(u"eLibrary.StringPool"_S).doIntern());
+        CHECK_NE(&StringSource, &String(u"eLibrary.StringPool."_S).doIntern());
+        CHECK_EQ(StringSource.doCompare(u"eLibrary.StringPool"), 0);
+        ::std::vector<const String*> StringTarget[4];
+        ThreadExecutor ThreadExecutorObject(4);
+        ::std::vector<::std::future<void>> ThreadFutureList;
+        for (auto &StringTargetCurrent : StringTarget)
+            ThreadFutureList.push_back(ThreadExecutorObject.doSubmit([&StringTargetCurrent] {
+                for (uintmax_t StringIndex = 0;StringIndex < 5000;++StringIndex)
+                    StringTargetCurrent.push_back(&String::valueOf(StringIndex % 1000).doIntern());
+            }));
+        for (auto &ThreadFuture : ThreadFutureList) ThreadFuture.get();
+        for (uintmax_t StringIndex = 0;StringIndex < 5000;++StringIndex) {
+            CHECK_EQ(StringTarget[0][StringIndex], StringTarget[1][StringIndex]);
+            CHECK_EQ(StringTarget[0][StringIndex], StringTarget[2][StringIndex]);
+            CHECK_EQ(StringTarget[0][StringIndex], StringTarget[3][StringIndex]);
+            CHECK_EQ(StringTarget[0][StringIndex], StringTarget[0][StringIndex % 1000]);
+        }
+        CHECK_GE(StringPool::getInstance().getStringSize(), 1002);
+        const String &StringLong = String(u"eLibrary.StringPool.CanonicalLongString"_S).doIntern();
+        CHECK_EQ(StringLong.getMemoryResource(), HeapMemoryResource::getInstance());
+        AtomicStorage<uintmax_t> StringMismatch(0);
+        ThreadFutureList.clear();
+        for (uintmax_t ThreadIndex = 0;ThreadIndex < 2;++ThreadIndex)
+            ThreadFutureList.push_back(ThreadExecutorObject.doSubmit([&] {
+                for (uintmax_t StringIndex = 0;StringIndex < 10000;++StringIndex) {
+                    String StringCopy(StringLong);
+                    if (StringCopy.getMemoryResource() != HeapMemoryResource::getInstance() || StringCopy.doTruncate(0, 8).doCompare(u"eLibrary"))
+                        StringMismatch.doFetchAdd(1);
+                }
+            }));
+        for (auto &ThreadFuture : ThreadFutureList) ThreadFuture.get();
+        CHECK_EQ(StringMismatch.getValue(), 0);
+    }
+
+    TEST_CASE("StringSearch") {
+        for (uintmax_t SearchEpoch = 0;SearchEpoch < 1000;++SearchEpoch) {
+            ::std::u16string StringSource, StringTarget;
+            char16_t CharacterBase = SearchEpoch & 1 ? u'a' : u'\u4E00';
+            uintmax_t StringSourceSize = RandomEngine() % 300, StringTargetSize = RandomEngine() % (SearchEpoch % 3 ? 6 : 60);
+            for (uintmax_t CharacterIndex = 0;CharacterIndex < StringSourceSize;++CharacterIndex)
+                StringSource.push_back(char16_t(CharacterBase + RandomEngine() % 3));
+            if (StringTargetSize <= StringSourceSize && RandomEngine() & 1) {
+                uintmax_t StringTargetStart = RandomEngine() % (StringSourceSize - StringTargetSize + 1);
+                StringTarget = StringSource.substr(StringTargetStart, StringTargetSize);
+            } else for (uintmax_t CharacterIndex = 0;CharacterIndex < StringTargetSize;++CharacterIndex)
+                StringTarget.push_back(char16_t(CharacterBase + RandomEngine() % 3));
+            String StringSourceObject(StringSource), StringTargetObject(StringTarget);
+            auto StringResult = StringSource.find(StringTarget);
+            CHECK_EQ(StringSourceObject.doFind(StringTargetObject), StringResult == ::std::u16string::npos ? -1 : (intmax_t) StringResult);
+            auto CharacterResult = StringSource.find(char16_t(CharacterBase + 2));
+            CHECK_EQ(StringSourceObject.doFind(char16_t(CharacterBase + 2)), CharacterResult == ::std::u16string::npos ? -1 : (intmax_t) CharacterResult);
+        }
+
+        String StringSource(u"a\u4E2Dbca\u4E2Dbcabc"_S);
+        CHECK_EQ(StringSource.doFind(u"abc"_S), 8);
+        CHECK_EQ(String(u"xxabcxx"_S).doFind(StringView(u"abc")), 2);
+        CHECK(StringSource.doReplace(u"\u4E2D"_S, u"-"_S).toU16String() == u"a-bca-bcabc");
+        CHECK(StringSource.doReplace(u"bc"_S, u""_S).toU16String() == u"a\u4E2Da\u4E2Da");
+        CHECK(StringSource.doReplace(u""_S, u"-"_S).toU16String() == StringSource.toU16String());
+        CHECK(StringSource.doStrip(u"\u4E2Db"_S).toU16String() == u"acacabc");
+        CHECK(StringSource.doStrip(u'a').toU16String() == u"\u4E2Dbc\u4E2Dbcbc");
+    }
+
+    TEST_CASE("StringView") {
+        String StringSource(u"  Content-Type: text/html \u4E2D  "_S);
+        StringView ViewSource(StringSource);
+        StringView ViewStrip(ViewSource.doTrim());
+        CHECK_EQ(ViewStrip.getCharacterSize(), StringSource.getCharacterSize() - 4);
+        CHECK(ViewStrip.isStartswith(u"Content-Type"));
+        CHECK(ViewStrip.isEndswith(u"\u4E2D"));
+        StringView ViewValue(ViewStrip.doTruncate(ViewStrip.doFind(u':') + 1, -1).doTrim().doStripSuffix(u"\u4E2D").doTrim(u' '));
+        CHECK_EQ(ViewValue.doCompare(u"text/html"_S), 0);
+        CHECK_EQ(String(u"text/html"_S).doCompare(ViewValue), 0);
+        CHECK_EQ(ViewValue.hashCode(), String(u"text/html"_S).hashCode());
+        CHECK(ViewValue.toString().isLatin1());
+        CHECK_EQ(ViewStrip.doStripPrefix(u"Content-Type:").doFind(ViewValue), 1);
+        CHECK_EQ(ViewStrip.doStripPrefix(u"Content-Length:").getCharacterSize(), ViewStrip.getCharacterSize());
+        CHECK_EQ((char16_t) ViewValue.getCharacter(-1), u'l');
+        CHECK_THROWS(ViewValue.doTruncate(0, 10));
+        CHECK(StringView(u"aab\u4E2Daa").doTrim(u'a').toString().toU16String() == u"b\u4E2D");
+        CHECK(StringView(u"abab").doTrim(u'a').toString().toU16String() == u"bab");
+
+        StringBuilder CharacterStream;
+        CharacterStream.addString(ViewValue);
+        CharacterStream.addString(u"; charset=utf-8");
+        CHECK(CharacterStream.toString().toU8String() == "text/html; charset=utf-8");
+        CHECK(StringSource.isContains(ViewValue));
     }
 
     TEST_CASE("UnicodeConversion") {
@@ -332,6 +1137,31 @@ TEST_SUITE("CharacterString") {
         CHECK_EQ(StringSource.doCompare(String::valueOf(StringSource.toU32String())), 0);
         CHECK_EQ(StringSource.doCompare(String::valueOf(StringSource.toWString())), 0);
     }
+
+    TEST_CASE("Utf8Conversion") {
+        String StringSource(String::valueOf(::std::string("\xF0\x9F\x98\x80 eLibrary \xC3\xA9")));
+        CHECK_EQ(StringSource.getCharacterSize(), 13);
+        CHECK_EQ(StringSource.toU16String(), u"\U0001F600 eLibrary \u00E9");
+        CHECK_EQ(StringSource.toU8String(), "\xF0\x9F\x98\x80 eLibrary \xC3\xA9");
+        CHECK(String::valueOf(::std::string("eLibrary \xC3\xA9")).isLatin1());
+        CHECK_EQ(String::valueOf(::std::string("eLibrary \xC3\xA9")).toU8String(), "eLibrary \xC3\xA9");
+        CHECK_EQ(String(u"\xD800" u"eLibrary").toU8String(), "\xEF\xBF\xBD" "eLibrary");
+        CHECK_THROWS(String::valueOf(::std::string("\xC0\xAF")));
+        CHECK_THROWS(String::valueOf(::std::string("\xED\xA0\x80")));
+        CHECK_THROWS(String::valueOf(::std::string("\xF4\x90\x80\x80")));
+        CHECK_THROWS(String::valueOf(::std::string("\xE4\xB8")));
+        ::std::u16string StringExpected;
+        for (uint32_t StringIndex = 0;StringIndex < 4096;++StringIndex) {
+            char32_t StringCharacter = RandomEngine() % 4 ? RandomEngine() % 0x80 : RandomEngine() % 0x10FFFF + 1;
+            if (StringCharacter >= 0xD800 && StringCharacter <= 0xDFFF) StringCharacter = u'?';
+            if (StringCharacter > 0xFFFF) {
+                StringExpected.push_back(char16_t(0xD800 + ((StringCharacter - 0x10000) >> 10)));
+                StringExpected.push_back(char16_t(0xDC00 + ((StringCharacter - 0x10000) & 0x3FF)));
+            } else StringExpected.push_back((char16_t) StringCharacter);
+        }
+        String StringTarget(StringExpected);
+        CHECK_EQ(String::valueOf(StringTarget.toU8String()).toU16String(), StringExpected);
+    }
 }
 
 #if eLibraryFeature(Network)